@@ -0,0 +1,389 @@
+/*
+    Benchmarks for the stella graph classes.
+
+    For every graph class and size, a child process builds a synthetic graph of
+    `size` nodes and `size` edges (a ring plus random chords) and times addNode,
+    addEdge, getNode, getEdge, operator== and LuaParser loading. Each result
+    reports nanoseconds and heap allocations per operation, and the peak resident
+    set size of the child so far, so every size is measured in a fresh process.
+
+    Results are printed as a single JSON document. See bench/Makefile to build,
+    and `./benchmark --help` for the options.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "stella.hpp"
+#include "graph_writer.tpp"
+#include "lua_parser.tpp"
+
+using std::string;
+using std::vector;
+
+/* ******************** ALLOCATION COUNTING  **************************/
+
+static std::atomic<size_t> allocations(0);
+
+// Every replaceable form is defined, so that all allocations are counted and every
+// delete matches its new.
+static void* allocate(size_t size, size_t alignment) noexcept {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (!size) size = 1;
+    if (alignment <= alignof(std::max_align_t)) return std::malloc(size);
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+// Out of line: once a delete is inlined next to the matching new, GCC would otherwise
+// report free() on memory from operator new (-Wmismatched-new-delete).
+__attribute__((noinline)) static void release(void* memory) noexcept {
+    std::free(memory);
+}
+
+static void* allocateOrThrow(size_t size, size_t alignment) {
+    if (void* memory = allocate(size, alignment)) return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size) {
+    return allocateOrThrow(size, 0);
+}
+
+void* operator new[](size_t size) {
+    return allocateOrThrow(size, 0);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, size_t(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, size_t(alignment));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, 0);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, 0);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, size_t(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, size_t(alignment));
+}
+
+void operator delete(void* memory) noexcept {
+    release(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    release(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    release(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+    release(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    release(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    release(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    release(memory);
+}
+
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept {
+    release(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    release(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    release(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    release(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    release(memory);
+}
+
+/* ******************** MEASUREMENT  **************************/
+
+struct Options {
+    vector<size_t> sizes{1000, 10000, 100000, 1000000, 10000000};
+    vector<string> graphs{"AdjList", "DirectedAdjList", "AdjMatrix", "DirectedAdjMatrix"};
+    // AdjMatrix allocates V x V cells and Lua loading is the slowest operation, so they
+    // stop at smaller sizes unless raised on the command line.
+    size_t matrixMax = 4096;
+    size_t equalityMax = 10000000;
+    size_t luaMax = 1000000;
+    string workdir = "/tmp";
+};
+
+static long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Times `body`, which performs `operations` operations, and writes one JSON result line to `out`.
+template<typename F>
+void measure(FILE* out, const string& graph, const string& operation, size_t size, size_t operations, F body) {
+    size_t allocationsBefore = allocations.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto end = std::chrono::steady_clock::now();
+    size_t allocated = allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    double count = operations ? (double) operations : 1.0;
+    fprintf(out, "{\"graph\": \"%s\", \"operation\": \"%s\", \"size\": %zu, \"operations\": %zu, "
+        "\"ns_per_op\": %.2f, \"allocs_per_op\": %.3f, \"peak_rss_kb\": %ld}\n",
+        graph.c_str(), operation.c_str(), size, operations, ns / count, allocated / count, peakRssKb());
+    fflush(out);
+}
+
+/* ******************** SYNTHETIC GRAPHS  **************************/
+
+struct Workload {
+    vector<string> nodes;
+    vector<stella::EdgeEntry> edges;
+    vector<size_t> lookupOrder;
+};
+
+static Workload makeWorkload(size_t size) {
+    Workload workload;
+    std::mt19937_64 random(size);
+    workload.nodes.reserve(size);
+    for (size_t i = 0; i < size; i++) workload.nodes.push_back("n" + std::to_string(i));
+
+    workload.edges.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+        // Half ring edges, so every node is reachable, half random chords.
+        size_t target = i % 2 == 0 ? (i + 1) % size : random() % size;
+        workload.edges.push_back({"e" + std::to_string(i), workload.nodes[i], workload.nodes[target],
+            (int) (random() % 100) + 1});
+    }
+
+    workload.lookupOrder.resize(size);
+    for (size_t i = 0; i < size; i++) workload.lookupOrder[i] = i;
+    std::shuffle(workload.lookupOrder.begin(), workload.lookupOrder.end(), random);
+    return workload;
+}
+
+template<typename N, typename E>
+bool findEdge(stella::AdjList<N, E>& graph, const stella::EdgeEntry& entry) {
+    return graph.getEdge(entry.label) != nullptr;
+}
+
+// Matrices have no label index, so an edge is looked up through the cell of its nodes.
+template<typename N, typename E>
+bool findEdge(stella::AdjMatrix<N, E>& graph, const stella::EdgeEntry& entry) {
+    int n1 = graph.getNodeIndex(entry.n1);
+    int n2 = graph.getNodeIndex(entry.n2);
+    if (n1 < 0 || n2 < 0) return false;
+    auto& cell = graph.getAllEdges()[n1][n2];
+    return cell.find(entry.label) != cell.end();
+}
+
+template<typename G>
+void build(G& graph, const Workload& workload) {
+    for (const string& label : workload.nodes) graph.addNode(label);
+    for (const stella::EdgeEntry& entry : workload.edges)
+        graph.addEdge(entry.label, entry.n1, entry.n2, entry.weight);
+}
+
+// Keeps the optimizer from dropping lookups whose result is otherwise unused.
+static volatile size_t sink;
+
+template<typename G>
+void runGraph(FILE* out, const string& name, size_t size, const Options& options) {
+    Workload workload = makeWorkload(size);
+    G graph;
+
+    measure(out, name, "addNode", size, size, [&]() {
+        for (const string& label : workload.nodes) graph.addNode(label);
+    });
+    measure(out, name, "addEdge", size, size, [&]() {
+        for (const stella::EdgeEntry& entry : workload.edges)
+            graph.addEdge(entry.label, entry.n1, entry.n2, entry.weight);
+    });
+    measure(out, name, "getNode", size, size, [&]() {
+        size_t found = 0;
+        for (size_t i : workload.lookupOrder) found += graph.getNode(workload.nodes[i]) != nullptr;
+        sink = found;
+    });
+    measure(out, name, "getEdge", size, size, [&]() {
+        size_t found = 0;
+        for (size_t i : workload.lookupOrder) found += findEdge(graph, workload.edges[i]);
+        sink = found;
+    });
+
+    if (size <= options.equalityMax) {
+        G copy;
+        build(copy, workload);
+        measure(out, name, "operator==", size, 1, [&]() {
+            sink = graph == copy;
+        });
+    }
+
+    if (size <= options.luaMax) {
+        string filename = options.workdir + "/stella_bench_" + std::to_string(getpid()) + ".lua";
+        stella::GraphWriter().writeLua(graph, filename);
+        stella::LuaParser parser;
+        {
+            G loaded;
+            measure(out, name, "luaLoad", size, 2 * size, [&]() { parser.load(filename, &loaded); });
+        }
+        {
+            G loaded;
+            measure(out, name, "luaLoadCached", size, 2 * size, [&]() { parser.load(filename, &loaded); });
+        }
+        remove(filename.c_str());
+    }
+}
+
+static void runChild(FILE* out, const string& graph, size_t size, const Options& options) {
+    using stella::Node;
+    if (graph == "AdjList")
+        runGraph<stella::AdjList<Node, stella::Edge>>(out, graph, size, options);
+    else if (graph == "DirectedAdjList")
+        runGraph<stella::DirectedAdjList<Node, stella::DirectedEdge>>(out, graph, size, options);
+    else if (graph == "AdjMatrix")
+        runGraph<stella::AdjMatrix<Node, stella::Edge>>(out, graph, size, options);
+    else if (graph == "DirectedAdjMatrix")
+        runGraph<stella::DirectedAdjMatrix<Node, stella::DirectedEdge>>(out, graph, size, options);
+}
+
+// Runs one graph class and size in a child process and appends its result lines to `results`.
+static bool runIsolated(const string& graph, size_t size, const Options& options, vector<string>& results) {
+    int fds[2];
+    if (pipe(fds) != 0) return false;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) return false;
+    if (pid == 0) {
+        close(fds[0]);
+        FILE* out = fdopen(fds[1], "w");
+        try {
+            runChild(out, graph, size, options);
+        } catch (std::exception& ex) {
+            fprintf(stderr, "%s %zu: %s\n", graph.c_str(), size, ex.what());
+            _exit(1);
+        }
+        fclose(out);
+        _exit(0);
+    }
+
+    close(fds[1]);
+    FILE* in = fdopen(fds[0], "r");
+    char line[1024];
+    while (fgets(line, sizeof(line), in)) {
+        string result(line);
+        if (!result.empty() && result.back() == '\n') result.pop_back();
+        results.push_back(result);
+    }
+    fclose(in);
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/* ******************** COMMAND LINE  **************************/
+
+template<typename T, typename F>
+vector<T> splitList(const string& text, F convert) {
+    vector<T> items;
+    std::stringstream stream(text);
+    string item;
+    while (std::getline(stream, item, ','))
+        if (!item.empty()) items.push_back(convert(item));
+    return items;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  --sizes N,N,...        graph sizes (default 1000,10000,100000,1000000,10000000)\n"
+        "  --graphs NAME,...      AdjList, DirectedAdjList, AdjMatrix, DirectedAdjMatrix\n"
+        "  --matrix-max N         largest size for the matrix classes (default 4096)\n"
+        "  --equality-max N       largest size for operator== (default 10000000)\n"
+        "  --lua-max N            largest size for LuaParser loading (default 1000000)\n"
+        "  --workdir DIR          where temporary Lua files are written (default /tmp)\n",
+        program);
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--help" || i + 1 >= argc) {
+            usage(argv[0]);
+            return arg == "--help" ? 0 : 2;
+        }
+        string value = argv[++i];
+        auto toSize = [](const string& text) { return (size_t) std::stoull(text); };
+        if (arg == "--sizes") options.sizes = splitList<size_t>(value, toSize);
+        else if (arg == "--graphs") options.graphs = splitList<string>(value, [](const string& text) { return text; });
+        else if (arg == "--matrix-max") options.matrixMax = toSize(value);
+        else if (arg == "--equality-max") options.equalityMax = toSize(value);
+        else if (arg == "--lua-max") options.luaMax = toSize(value);
+        else if (arg == "--workdir") options.workdir = value;
+        else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    vector<string> results;
+    bool ok = true;
+    for (const string& graph : options.graphs) {
+        bool matrix = graph.find("Matrix") != string::npos;
+        for (size_t size : options.sizes) {
+            if (matrix && size > options.matrixMax) continue;
+            if (!runIsolated(graph, size, options, results)) {
+                fprintf(stderr, "benchmark failed: %s with %zu elements\n", graph.c_str(), size);
+                ok = false;
+            }
+        }
+    }
+
+    printf("{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++)
+        printf("    %s%s\n", results[i].c_str(), i + 1 < results.size() ? "," : "");
+    printf("  ]\n}\n");
+    return ok ? 0 : 1;
+}
\ No newline at end of file
@@ -1,9 +1,11 @@
 #ifndef ADJ_LIST_TPP
 #define ADJ_LIST_TPP
 
+#include <algorithm>
 #include <exception>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 #include "graph.tpp"
 
@@ -11,61 +13,380 @@ using std::invalid_argument;
 using std::map;
 using std::make_shared;
 using std::shared_ptr;
+using std::unordered_map;
 
 namespace stella {
+    template<typename N, typename E>
+    class AdjMatrix;
+
     template<typename N, typename E>
     class AdjList: public Graph<N, E> {
-        static_assert(is_base_of<Edge, E>::value, "E must be of type stella::Edge for non-directed graphs");
+        static_assert(is_edge<E>::value, "E must be of type stella::BasicEdge for non-directed graphs");
+        public:
+            using Weight = typename Graph<N, E>::Weight;
         protected:
             vector<shared_ptr<N>> nodes;
             map<string, shared_ptr<E>> edges;
+            unordered_map<string, int> nodeIndex;
+            // Edges touching each node, by node index; a self-loop is listed once.
+            vector<vector<shared_ptr<E>>> incidence;
+            void insertNode(shared_ptr<N> node) {
+                STELLA_STAT_SNAPSHOT(capacity, nodes.capacity());
+                STELLA_STAT_SNAPSHOT(buckets, nodeIndex.bucket_count());
+                nodeIndex.emplace(node->getLabel(), nodes.size());
+                nodes.push_back(node);
+                incidence.emplace_back();
+                this->fingerprint += nodeFingerprint(node->getLabel());
+                this->epoch.advance();
+                this->trackNodes(nodes.size());
+                STELLA_STAT_IF_CHANGED(capacity, nodes.capacity(), reallocations);
+                STELLA_STAT_IF_CHANGED(buckets, nodeIndex.bucket_count(), reallocations);
+            }
+            void insertEdge(shared_ptr<E> edge, int n1, int n2) {
+                edges.insert({edge->getLabel(), edge});
+                linkIncidence(edge, n1, n2);
+                this->fingerprint += edgeFingerprint(*edge);
+                this->epoch.advance();
+                this->trackEdge(n1, n2);
+            }
+            void linkIncidence(const shared_ptr<E>& edge, int n1, int n2) {
+                incidence[n1].push_back(edge);
+                if (n2 != n1) incidence[n2].push_back(edge);
+            }
+            // Swap-and-pop, so it costs the degree of the node.
+            void unlinkIncidence(const E* edge, int node) {
+                vector<shared_ptr<E>>& list = incidence[node];
+                for (size_t i = 0; i < list.size(); i++) {
+                    if (list[i].get() == edge) {
+                        list[i].swap(list.back());
+                        list.pop_back();
+                        return;
+                    }
+                }
+            }
+            static bool joins(const E& edge, const string& n1, const string& n2) {
+                string first = edge.getN1()->getLabel(), second = edge.getN2()->getLabel();
+                if (first == n1 && second == n2) return true;
+                return !is_directed<E>::value && first == n2 && second == n1;
+            }
+            shared_ptr<E> eraseEdge(typename map<string, shared_ptr<E>>::iterator it) {
+                shared_ptr<E> edge = it->second;
+                int n1 = getNodeIndex(edge->getN1()->getLabel());
+                int n2 = getNodeIndex(edge->getN2()->getLabel());
+                unlinkIncidence(edge.get(), n1);
+                if (n2 != n1) unlinkIncidence(edge.get(), n2);
+                edges.erase(it);
+                this->fingerprint -= edgeFingerprint(*edge);
+                this->epoch.advance();
+                this->dropComponents();
+                return edge;
+            }
+            int findNodeIndex(const string& label) override {
+                return getNodeIndex(label);
+            }
+            // Each edge is met from both ends, the second time as a no-op.
+            void uniteEdges(UnionFind& sets) override {
+                for (int i = 0; i < (int) incidence.size(); i++) {
+                    for (const shared_ptr<E>& edge : incidence[i]) {
+                        const string& n1 = edge->getN1()->getLabel();
+                        const string& other = n1 == nodes[i]->getLabel() ? edge->getN2()->getLabel() : n1;
+                        sets.unite(i, getNodeIndex(other));
+                    }
+                }
+            }
         public:
             AdjList() {}
+            /*
+                Converts `matrix` in O(V^2 + E log E), reading every cell once. Node indices
+                stay the same, and the node and edge objects, which are immutable, are shared
+                with `matrix`. Edge labels are only unique per cell in a matrix, so a label
+                met twice throws invalid_argument.
+            */
+            explicit AdjList(AdjMatrix<N, E>& matrix) {
+                nodes = matrix.getAllNodes();
+                nodeIndex.reserve(nodes.size());
+                for (size_t i = 0; i < nodes.size(); i++) nodeIndex.emplace(nodes[i]->getLabel(), i);
+                incidence.resize(nodes.size());
+                auto& cells = matrix.getAllEdges();
+                int size = nodes.size();
+                for (int i = 0; i < size; i++) {
+                    // Non-directed edges are stored in both halves, so only the upper one is read.
+                    for (int j = is_directed<E>::value ? 0 : i; j < size; j++) {
+                        for (auto& pair : cells[i][j]) {
+                            if (!edges.emplace(pair.first, pair.second).second)
+                                throw invalid_argument("Edge already exists: " + pair.first);
+                            bool forward = is_directed<E>::value || i == j
+                                || pair.second->n1->getLabel() == nodes[i]->getLabel();
+                            linkIncidence(pair.second, forward ? i : j, forward ? j : i);
+                        }
+                    }
+                }
+                this->fingerprint = matrix.getFingerprint();
+                this->epoch.advance();
+            }
             void addNode(shared_ptr<N> node) override {
-                if (getNode(node->getLabel()))
+                STELLA_STAT_TIMER(timer, nodeInserts);
+                if (nodeIndex.count(node->getLabel()))
                     throw invalid_argument("Node already exists: " + node->getLabel());
-                nodes.push_back(node);
+                insertNode(node);
+                STELLA_STAT_SUCCEED(timer);
             }
             void addNode(string label) override {
-                if (getNode(label))
+                STELLA_STAT_TIMER(timer, nodeInserts);
+                if (nodeIndex.count(label))
                     throw invalid_argument("Node already exists: " + label);
                 shared_ptr<N> node = make_shared<N>(label);
-                nodes.push_back(node);
+                insertNode(node);
+                STELLA_STAT_SUCCEED(timer);
+            }
+            void reserve(size_t nodeCount, size_t edgeCount) override {
+                nodes.reserve(nodeCount);
+                nodeIndex.reserve(nodeCount);
+                incidence.reserve(nodeCount);
+            }
+            // All or nothing: on a duplicate label the batch is rolled back before throwing.
+            void addNodes(const vector<string>& labels) override {
+                STELLA_STAT_TIMER(timer, bulkNodeInserts);
+                STELLA_STAT_SNAPSHOT(capacity, nodes.capacity());
+                size_t first = nodes.size();
+                reserve(first + labels.size(), 0);
+                for (const string& label : labels) {
+                    if (!nodeIndex.emplace(label, nodes.size()).second) {
+                        for (size_t i = first; i < nodes.size(); i++) {
+                            nodeIndex.erase(nodes[i]->getLabel());
+                            this->fingerprint -= nodeFingerprint(nodes[i]->getLabel());
+                        }
+                        nodes.resize(first);
+                        throw invalid_argument("Node already exists: " + label);
+                    }
+                    nodes.push_back(make_shared<N>(label));
+                    this->fingerprint += nodeFingerprint(label);
+                }
+                incidence.resize(nodes.size());
+                this->epoch.advance();
+                this->trackNodes(nodes.size());
+                STELLA_STAT_IF_CHANGED(capacity, nodes.capacity(), reallocations);
+                STELLA_STAT_SUCCEED(timer);
+            }
+            void addEdges(const vector<BasicEdgeEntry<Weight>>& entries) override {
+                STELLA_STAT_TIMER(timer, bulkEdgeInserts);
+                vector<shared_ptr<E>> batch;
+                vector<int> ends;
+                batch.reserve(entries.size());
+                ends.reserve(entries.size() * 2);
+                for (const BasicEdgeEntry<Weight>& entry : entries) {
+                    int node1 = getNodeIndex(entry.n1);
+                    int node2 = getNodeIndex(entry.n2);
+                    if (node1 < 0 || node2 < 0)
+                        throw invalid_argument("Node labels not found: " + entry.n1 + " " + entry.n2);
+                    batch.push_back(make_shared<E>(entry.label, nodes[node1], nodes[node2], entry.weight));
+                    ends.push_back(node1);
+                    ends.push_back(node2);
+                }
+                auto hint = edges.end();
+                for (size_t i = 0; i < batch.size(); i++) {
+                    size_t before = edges.size();
+                    hint = edges.emplace_hint(hint, batch[i]->getLabel(), batch[i]);
+                    if (edges.size() == before) {
+                        for (size_t j = 0; j < i; j++) {
+                            edges.erase(batch[j]->getLabel());
+                            this->fingerprint -= edgeFingerprint(*batch[j]);
+                        }
+                        throw invalid_argument("Edge already exists: " + batch[i]->getLabel());
+                    }
+                    this->fingerprint += edgeFingerprint(*batch[i]);
+                }
+                for (size_t i = 0; i < batch.size(); i++) {
+                    linkIncidence(batch[i], ends[2 * i], ends[2 * i + 1]);
+                    this->trackEdge(ends[2 * i], ends[2 * i + 1]);
+                }
+                this->epoch.advance();
+                STELLA_STAT_SUCCEED(timer);
             }
             void addEdge(shared_ptr<E> edge) override {
-                if (getEdge(edge->getLabel()))
+                STELLA_STAT_TIMER(timer, edgeInserts);
+                if (edges.count(edge->getLabel()))
                     throw invalid_argument("Edge already exists: " + edge->getLabel());
-                edges.insert({edge->getLabel(), edge});
+                int n1 = getNodeIndex(edge->getN1()->getLabel());
+                int n2 = getNodeIndex(edge->getN2()->getLabel());
+                if (n1 < 0 || n2 < 0)
+                    throw invalid_argument("Node labels not found: "
+                        + edge->getN1()->getLabel() + " " + edge->getN2()->getLabel());
+                insertEdge(edge, n1, n2);
+                STELLA_STAT_SUCCEED(timer);
             }
             void addEdge(string label, string n1, string n2) override {
-                if (getEdge(label))
+                STELLA_STAT_TIMER(timer, edgeInserts);
+                if (edges.count(label))
                     throw invalid_argument("Edge already exists: " + label);
-                shared_ptr<N> node1 = getNode(n1);
-                shared_ptr<N> node2 = getNode(n2);
-                if (!node1 || !node2)
+                int node1 = getNodeIndex(n1);
+                int node2 = getNodeIndex(n2);
+                if (node1 < 0 || node2 < 0)
                     throw invalid_argument("Node labels not found: " + n1 + " " + n2);
-                shared_ptr<E> edge = make_shared<E>(label, node1, node2);
-                edges.insert({label, edge});
+                shared_ptr<E> edge = make_shared<E>(label, nodes[node1], nodes[node2]);
+                insertEdge(edge, node1, node2);
+                STELLA_STAT_SUCCEED(timer);
             }
-            void addEdge(string label, string n1, string n2, int weight) override {
-                if (getEdge(label))
+            void addEdge(string label, string n1, string n2, Weight weight) override {
+                STELLA_STAT_TIMER(timer, edgeInserts);
+                if (edges.count(label))
                     throw invalid_argument("Edge already exists: " + label);
-                shared_ptr<N> node1 = getNode(n1);
-                shared_ptr<N> node2 = getNode(n2);
-                if (!node1 || !node2)
+                int node1 = getNodeIndex(n1);
+                int node2 = getNodeIndex(n2);
+                if (node1 < 0 || node2 < 0)
                     throw invalid_argument("Node labels not found: " + n1 + " " + n2);
-                shared_ptr<E> edge = make_shared<E>(label, node1, node2, weight);
-                edges.insert({edge->getLabel(), edge});
+                shared_ptr<E> edge = make_shared<E>(label, nodes[node1], nodes[node2], weight);
+                insertEdge(edge, node1, node2);
+                STELLA_STAT_SUCCEED(timer);
+            }
+            // Removes the node and every edge touching it, in O(degree). The last node takes
+            // the index of the removed one, so node indices are only stable until a removal.
+            shared_ptr<N> removeNode(string label) override {
+                STELLA_STAT_TIMER(timer, nodeRemovals);
+                int index = getNodeIndex(label);
+                if (index < 0)
+                    throw invalid_argument("Node not found: " + label);
+                vector<shared_ptr<E>> incident;
+                incident.swap(incidence[index]);
+                for (const shared_ptr<E>& edge : incident) {
+                    const string& other = edge->getN1()->getLabel() == label
+                        ? edge->getN2()->getLabel() : edge->getN1()->getLabel();
+                    int otherIndex = getNodeIndex(other);
+                    if (otherIndex != index) unlinkIncidence(edge.get(), otherIndex);
+                    edges.erase(edge->getLabel());
+                    this->fingerprint -= edgeFingerprint(*edge);
+                }
+
+                shared_ptr<N> node = nodes[index];
+                int last = nodes.size() - 1;
+                if (index != last) {
+                    nodes[index].swap(nodes[last]);
+                    incidence[index].swap(incidence[last]);
+                    nodeIndex[nodes[index]->getLabel()] = index;
+                }
+                nodes.pop_back();
+                incidence.pop_back();
+                nodeIndex.erase(label);
+                this->fingerprint -= nodeFingerprint(label);
+                this->epoch.advance();
+                this->dropComponents();
+                STELLA_STAT_SUCCEED(timer);
+                return node;
+            }
+            shared_ptr<E> removeEdge(string label) {
+                STELLA_STAT_TIMER(timer, edgeRemovals);
+                auto it = edges.find(label);
+                if (it == edges.end())
+                    throw invalid_argument("Edge not found: " + label);
+                shared_ptr<E> edge = eraseEdge(it);
+                STELLA_STAT_SUCCEED(timer);
+                return edge;
+            }
+            // Like removeEdge(label), but only if the edge joins `n1` and `n2`.
+            shared_ptr<E> removeEdge(string label, string n1, string n2) override {
+                STELLA_STAT_TIMER(timer, edgeRemovals);
+                auto it = edges.find(label);
+                if (it == edges.end() || !joins(*it->second, n1, n2))
+                    throw invalid_argument("Edge not found: " + label + " " + n1 + " " + n2);
+                shared_ptr<E> edge = eraseEdge(it);
+                STELLA_STAT_SUCCEED(timer);
+                return edge;
+            }
+            // Node objects and incidence lists are moved, not copied: O(V).
+            void permuteNodes(const vector<int64_t>& order) override {
+                this->checkPermutation(order);
+                vector<shared_ptr<N>> permuted(nodes.size());
+                vector<vector<shared_ptr<E>>> lists(nodes.size());
+                for (size_t i = 0; i < order.size(); i++) {
+                    permuted[i].swap(nodes[order[i]]);
+                    lists[i].swap(incidence[order[i]]);
+                    nodeIndex[permuted[i]->getLabel()] = i;
+                }
+                nodes.swap(permuted);
+                incidence.swap(lists);
+                this->epoch.advance();
+                this->dropComponents();
+            }
+            /*
+                Fills the empty `subgraph` with copies of the nodes at `selected` indices, in
+                that order (repeats are skipped), and of the edges between them. Old indices
+                map to new ones through a dense vector, and labels are known to be unique, so
+                nothing is looked up or checked per edge: O(V) for the map, plus the degrees
+                of the selected nodes. See subgraph.tpp.
+            */
+            void extractSubgraph(const vector<int>& selected, AdjList<N, E>& subgraph) {
+                if (!subgraph.nodes.empty() || !subgraph.edges.empty())
+                    throw invalid_argument("Subgraph must be empty");
+                vector<int> position(nodes.size(), -1);
+                vector<int> kept;
+                kept.reserve(selected.size());
+                subgraph.reserve(selected.size(), 0);
+                for (int index : selected) {
+                    if (index < 0 || index >= (int) nodes.size())
+                        throw invalid_argument("Node index out of range: " + std::to_string(index));
+                    if (position[index] >= 0) continue;
+                    position[index] = kept.size();
+                    kept.push_back(index);
+                    const string& label = nodes[index]->getLabel();
+                    subgraph.nodeIndex.emplace(label, subgraph.nodes.size());
+                    subgraph.nodes.push_back(make_shared<N>(label));
+                    subgraph.fingerprint += nodeFingerprint(label);
+                }
+                subgraph.incidence.resize(subgraph.nodes.size());
+
+                // Every edge is listed at its first end, where it is taken.
+                vector<shared_ptr<E>> batch;
+                for (size_t i = 0; i < kept.size(); i++) {
+                    for (const shared_ptr<E>& edge : incidence[kept[i]]) {
+                        if (edge->getN1()->getLabel() != nodes[kept[i]]->getLabel()) continue;
+                        int other = position[getNodeIndex(edge->getN2()->getLabel())];
+                        if (other < 0) continue;
+                        shared_ptr<E> copy = make_shared<E>(edge->getLabel(),
+                            subgraph.nodes[i], subgraph.nodes[other], edge->getWeight());
+                        subgraph.linkIncidence(copy, i, other);
+                        subgraph.fingerprint += edgeFingerprint(*copy);
+                        batch.push_back(copy);
+                    }
+                }
+                std::sort(batch.begin(), batch.end(), [](const shared_ptr<E>& first, const shared_ptr<E>& second) {
+                    return first->getLabel() < second->getLabel();
+                });
+                for (const shared_ptr<E>& edge : batch)
+                    subgraph.edges.emplace_hint(subgraph.edges.end(), edge->getLabel(), edge);
+                subgraph.epoch.advance();
+            }
+            // Calls `visit(edge)` once for every edge touching the node.
+            template<typename F>
+            void forEachIncidentEdge(const string& label, F visit) {
+                int index = getNodeIndex(label);
+                if (index < 0) return;
+                for (const shared_ptr<E>& edge : incidence[index]) visit(edge);
+            }
+            // The edges touching the node, valid until the graph changes; see ranges.tpp.
+            const vector<shared_ptr<E>>& getIncidentEdges(const string& label) const {
+                int index = getNodeIndex(label);
+                if (index < 0)
+                    throw invalid_argument("Node not found: " + label);
+                return incidence[index];
             }
             shared_ptr<E> getEdge(string label) {
+                STELLA_STAT_TIMER(timer, edgeLookups);
                 auto it = edges.find(label);
+                STELLA_STAT_RESULT(timer, it != edges.end());
                 if (it != edges.end()) return it->second;
                 return nullptr;
             }
             shared_ptr<N> getNode(string label) override {
-                for (shared_ptr<N> node: nodes) {
-                    if (node->getLabel().compare(label) == 0) return node;
-                } return nullptr;
+                STELLA_STAT_TIMER(timer, nodeLookups);
+                auto it = nodeIndex.find(label);
+                STELLA_STAT_RESULT(timer, it != nodeIndex.end());
+                if (it != nodeIndex.end()) return nodes[it->second];
+                return nullptr;
+            }
+            int getNodeIndex(const string& label) const {
+                auto it = nodeIndex.find(label);
+                if (it != nodeIndex.end()) return it->second;
+                return -1;
             }
             std::vector<shared_ptr<N>>& getAllNodes() override {
                 return nodes;
@@ -73,26 +394,39 @@ namespace stella {
             std::map<string, shared_ptr<E>>& getAllEdges() {
                 return edges;
             }
+            MemoryUsage memoryUsage() override {
+                MemoryUsage usage = Graph<N, E>::memoryUsage();
+                usage.containers += hashTableSize(nodeIndex);
+                for (const auto& pair : nodeIndex) usage.labels += labelBytes(pair.first);
+                usage.containers += edges.size() * treeNodeSize<map<string, shared_ptr<E>>>();
+                usage.containers += vectorSize(incidence);
+                for (const auto& list : incidence) usage.containers += vectorSize(list);
+                for (const auto& pair : edges) {
+                    addShared<E>(usage, usage.edges);
+                    usage.labels += labelBytes(pair.first) + labelBytes(pair.second->label);
+                }
+                return usage;
+            }
+            // Calls `visit(edge)` once for every edge, in label order.
+            template<typename F>
+            void forEachEdge(F visit) {
+                for (auto& pair : edges) visit(pair.second);
+            }
+            // Equal node labels and, label by label, equal edges. The fingerprints reject most
+            // unequal graphs in O(1); otherwise the comparison is a single pass over both graphs.
             friend bool operator==(AdjList<N,E>& first, AdjList<N, E>& second) {
+                if (first.fingerprint != second.fingerprint) return false;
                 if (first.nodes.size() != second.nodes.size()) return false;
-                for (int i = 0; i < first.nodes.size(); i++) {
-                    bool node_present = false;
-                    for (int j = 0; j < second.nodes.size(); j++) {
-                        if (*(first.nodes[i]) == *(second.nodes[j])) {
-                            node_present = true;
-                            break;
-                        };
-                    }
-                    if (!node_present) return false;
-                }
-
                 if (first.edges.size() != second.edges.size()) return false;
+                for (const shared_ptr<N>& node : first.nodes) {
+                    if (!second.nodeIndex.count(node->getLabel())) return false;
+                }
+                // Both maps are ordered by label, so matching edges are walked in step.
+                auto secondPair = second.edges.begin();
                 for (const auto& firstPair : first.edges) {
-                    auto secondPair = second.edges.find(firstPair.first);
-
-                    if (secondPair == second.edges.end()) return false;
-
+                    if (firstPair.first != secondPair->first) return false;
                     if (*(firstPair.second) != *(secondPair->second)) return false;
+                    ++secondPair;
                 }
                 return true;
             }
@@ -111,9 +445,10 @@ namespace stella {
 
     template<typename N, typename E>
     class DirectedAdjList: public AdjList<N, E> {
-        static_assert(is_base_of<DirectedEdge, E>::value, "E must be of type stella::DirectedEdge for directed graphs");
+        static_assert(is_directed<E>::value, "E must be of type stella::BasicDirectedEdge for directed graphs");
         public:
             DirectedAdjList(): AdjList<N, E>() {}
+            explicit DirectedAdjList(AdjMatrix<N, E>& matrix) : AdjList<N, E>(matrix) {}
             map<string, shared_ptr<E>>& getAllEdges() {
                 return this->edges;
             }
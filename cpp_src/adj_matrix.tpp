@@ -4,6 +4,7 @@
 #include <exception>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "graph.tpp"
@@ -13,81 +14,354 @@ using std::make_shared;
 using std::map;
 using std::vector;
 using std::shared_ptr;
+using std::unordered_map;
 
 namespace stella {
+    template<typename N, typename E>
+    class AdjList;
+
     template<typename N, typename E>
     class AdjMatrix : public Graph<N, E> {
-        static_assert(is_base_of<Edge, E>::value, "E must be of type stella::Edge for non-directed graphs");
+        static_assert(is_edge<E>::value, "E must be of type stella::BasicEdge for non-directed graphs");
+    public:
+        using Weight = typename Graph<N, E>::Weight;
     protected:
         void pushNode(int size) {
+            STELLA_STAT_EVENT(growths);
+            STELLA_STAT_SNAPSHOT(rows, this->edges.capacity());
             this->edges.push_back(vector<map<string, shared_ptr<E>>>{});
+            STELLA_STAT_IF_CHANGED(rows, this->edges.capacity(), reallocations);
             for(int i = 0; i < size; i++) {
+                STELLA_STAT_SNAPSHOT(cells, this->edges[i].capacity());
                 if (i != size - 1)
                     this->edges[i].push_back(map<string, shared_ptr<E>>{});
                 else
                     for (int j = 0; j < size; j++)
                         this->edges[i].push_back(map<string, shared_ptr<E>>{});
+                STELLA_STAT_IF_CHANGED(cells, this->edges[i].capacity(), reallocations);
+            }
+        }
+        void insertNode(shared_ptr<N> node) {
+            STELLA_STAT_SNAPSHOT(capacity, nodes.capacity());
+            STELLA_STAT_SNAPSHOT(buckets, nodeIndex.bucket_count());
+            nodeIndex.emplace(node->getLabel(), nodes.size());
+            nodes.push_back(node);
+            this->fingerprint += nodeFingerprint(node->getLabel());
+            this->epoch.advance();
+            STELLA_STAT_IF_CHANGED(capacity, nodes.capacity(), reallocations);
+            STELLA_STAT_IF_CHANGED(buckets, nodeIndex.bucket_count(), reallocations);
+            pushNode(nodes.size());
+            this->trackNodes(nodes.size());
+        }
+        // Grows every row once for a whole batch instead of once per node.
+        void growMatrix(size_t size) {
+            STELLA_STAT_EVENT(growths);
+            for (auto& row : this->edges) {
+                STELLA_STAT_SNAPSHOT(cells, row.capacity());
+                row.resize(size);
+                STELLA_STAT_IF_CHANGED(cells, row.capacity(), reallocations);
             }
+            STELLA_STAT_SNAPSHOT(rows, this->edges.capacity());
+            this->edges.resize(size, vector<map<string, shared_ptr<E>>>(size));
+            STELLA_STAT_IF_CHANGED(rows, this->edges.capacity(), reallocations);
+        }
+        // Stores the edge in its cells. A cell keeps the first edge of each label, so the
+        // edge is only counted when it was not already there.
+        virtual void linkEdge(int n1, int n2, shared_ptr<E> edge) {
+            if (!this->edges[n1][n2].insert({edge->getLabel(), edge}).second) return;
+            this->edges[n2][n1].insert({edge->getLabel(), edge});
+            countEdge(*edge);
+            this->trackEdge(n1, n2);
+        }
+        virtual void unlinkEdge(int n1, int n2, const string& label) {
+            this->edges[n1][n2].erase(label);
+            this->edges[n2][n1].erase(label);
+        }
+        void countEdge(const E& edge) {
+            edgeCount++;
+            this->fingerprint += edgeFingerprint(edge);
+            this->epoch.advance();
+        }
+        void uncountEdge(const E& edge) {
+            edgeCount--;
+            this->fingerprint -= edgeFingerprint(edge);
+            this->epoch.advance();
         }
         vector<shared_ptr<N>> nodes;
         vector<vector<map<string, shared_ptr<E>>>> edges;
+        unordered_map<string, int> nodeIndex;
+        size_t edgeCount = 0;
+        int findNodeIndex(const string& label) override {
+            return getNodeIndex(label);
+        }
+        // Reads every cell, O(V^2) like the matrix itself.
+        void uniteEdges(UnionFind& sets) override {
+            for (int i = 0; i < (int) edges.size(); i++) {
+                for (int j = 0; j < (int) edges[i].size(); j++)
+                    if (!edges[i][j].empty()) sets.unite(i, j);
+            }
+        }
     public:
         AdjMatrix() {}
+        // Converts `list` in O(V^2 + E), the cost of the cells. Node indices stay the same,
+        // and the node and edge objects, which are immutable, are shared with `list`.
+        explicit AdjMatrix(AdjList<N, E>& list) {
+            nodes = list.getAllNodes();
+            nodeIndex.reserve(nodes.size());
+            for (size_t i = 0; i < nodes.size(); i++) nodeIndex.emplace(nodes[i]->getLabel(), i);
+            growMatrix(nodes.size());
+            for (int i = 0; i < (int) nodes.size(); i++) {
+                // Every edge is taken at its first end.
+                for (const shared_ptr<E>& edge : list.getIncidentEdges(nodes[i]->getLabel())) {
+                    if (getNodeIndex(edge->n1->getLabel()) != i) continue;
+                    int other = getNodeIndex(edge->n2->getLabel());
+                    edges[i][other].emplace(edge->getLabel(), edge);
+                    if (!is_directed<E>::value && other != i) edges[other][i].emplace(edge->getLabel(), edge);
+                    edgeCount++;
+                }
+            }
+            this->fingerprint = list.getFingerprint();
+            this->epoch.advance();
+        }
         void addNode(shared_ptr<N> node) {
-            if (getNode(node->getLabel()))
+            STELLA_STAT_TIMER(timer, nodeInserts);
+            if (nodeIndex.count(node->getLabel()))
                 throw invalid_argument("Node already exists: " + node->getLabel());
-            nodes.push_back(node);
-            pushNode(nodes.size());
+            insertNode(node);
+            STELLA_STAT_SUCCEED(timer);
         }
         void addNode(std::string label) {
-            if (getNode(label))
+            STELLA_STAT_TIMER(timer, nodeInserts);
+            if (nodeIndex.count(label))
                 throw invalid_argument("Node already exists: " + label);
             shared_ptr<N> node = make_shared<N>(label);
-            nodes.push_back(node);
-            pushNode(nodes.size());
+            insertNode(node);
+            STELLA_STAT_SUCCEED(timer);
+        }
+        void reserve(size_t nodeCount, size_t edgeCount) override {
+            nodes.reserve(nodeCount);
+            nodeIndex.reserve(nodeCount);
+            edges.reserve(nodeCount);
+        }
+        // All or nothing: on a duplicate label the batch is rolled back before throwing.
+        void addNodes(const vector<string>& labels) override {
+            STELLA_STAT_TIMER(timer, bulkNodeInserts);
+            STELLA_STAT_SNAPSHOT(capacity, nodes.capacity());
+            size_t first = nodes.size();
+            reserve(first + labels.size(), 0);
+            for (const string& label : labels) {
+                if (!nodeIndex.emplace(label, nodes.size()).second) {
+                    for (size_t i = first; i < nodes.size(); i++) {
+                        nodeIndex.erase(nodes[i]->getLabel());
+                        this->fingerprint -= nodeFingerprint(nodes[i]->getLabel());
+                    }
+                    nodes.resize(first);
+                    throw invalid_argument("Node already exists: " + label);
+                }
+                nodes.push_back(make_shared<N>(label));
+                this->fingerprint += nodeFingerprint(label);
+            }
+            STELLA_STAT_IF_CHANGED(capacity, nodes.capacity(), reallocations);
+            growMatrix(nodes.size());
+            this->epoch.advance();
+            this->trackNodes(nodes.size());
+            STELLA_STAT_SUCCEED(timer);
+        }
+        void addEdges(const vector<BasicEdgeEntry<Weight>>& entries) override {
+            STELLA_STAT_TIMER(timer, bulkEdgeInserts);
+            vector<int> ends;
+            ends.reserve(entries.size() * 2);
+            for (const BasicEdgeEntry<Weight>& entry : entries) {
+                int node1 = getNodeIndex(entry.n1);
+                int node2 = getNodeIndex(entry.n2);
+                if (node1 < 0 || node2 < 0)
+                    throw invalid_argument("Node labels not found: " + entry.n1 + " " + entry.n2);
+                ends.push_back(node1);
+                ends.push_back(node2);
+            }
+            for (size_t i = 0; i < entries.size(); i++) {
+                int node1 = ends[2 * i], node2 = ends[2 * i + 1];
+                linkEdge(node1, node2, make_shared<E>(entries[i].label,
+                    this->nodes[node1], this->nodes[node2], entries[i].weight));
+            }
+            STELLA_STAT_SUCCEED(timer);
         }
         void addEdge(shared_ptr<E> edge) {
+            STELLA_STAT_TIMER(timer, edgeInserts);
             int n1 = this->getNodeIndex(edge->getN1()->getLabel());
             int n2 = this->getNodeIndex(edge->getN2()->getLabel());
             if (n1 < 0 || n2 < 0)
                 throw invalid_argument("Node labels not found: "
                     + edge->getN1()->getLabel() + " " + edge->getN2()->getLabel());
-            this->edges[n1][n2].insert({edge->getLabel(), edge});
-            this->edges[n2][n1].insert({edge->getLabel(), edge});
+            linkEdge(n1, n2, edge);
+            STELLA_STAT_SUCCEED(timer);
         }
         void addEdge(string label, string n1, string n2) {
+            STELLA_STAT_TIMER(timer, edgeInserts);
             int node1 = this->getNodeIndex(n1);
             int node2 = this->getNodeIndex(n2);
             if (node1 < 0 || node2 < 0)
                 throw invalid_argument("Node labels not found: " + n1 + " " + n2);
-            shared_ptr<E> edge = make_shared<E>(label, this->nodes[node1], this->nodes[node2], 1);
-            this->edges[node1][node2].insert({edge->getLabel(), edge});
-            this->edges[node2][node1].insert({edge->getLabel(), edge});
+            shared_ptr<E> edge = make_shared<E>(label, this->nodes[node1], this->nodes[node2]);
+            linkEdge(node1, node2, edge);
+            STELLA_STAT_SUCCEED(timer);
         }
 
-        void addEdge(string label, string n1, string n2, int weight) {
+        void addEdge(string label, string n1, string n2, Weight weight) {
+            STELLA_STAT_TIMER(timer, edgeInserts);
             int node1 = this->getNodeIndex(n1);
             int node2 = this->getNodeIndex(n2);
             if (node1 < 0 || node2 < 0)
                 throw invalid_argument("Node labels not found: " + n1 + " " + n2);
             shared_ptr<E> edge = make_shared<E>(label, this->nodes[node1], this->nodes[node2], weight);
-            this->edges[node1][node2].insert({edge->getLabel(), edge});
-            this->edges[node2][node1].insert({edge->getLabel(), edge});
+            linkEdge(node1, node2, edge);
+            STELLA_STAT_SUCCEED(timer);
         }
-        shared_ptr<N> getNode(std::string label) {
-            for (shared_ptr<N> node : nodes) {
-                if (node->getLabel().compare(label) == 0) return node;
+        // Removes the node and its edges. The row and column of the last node are swapped
+        // into its place, which moves cells without copying them: O(V) for a V x V matrix.
+        // The freed capacity is kept for later inserts until compact() is called.
+        shared_ptr<N> removeNode(string label) override {
+            STELLA_STAT_TIMER(timer, nodeRemovals);
+            int index = getNodeIndex(label);
+            if (index < 0)
+                throw invalid_argument("Node not found: " + label);
+            forEachIncidentEdge(label, [&](const shared_ptr<E>& edge) { uncountEdge(*edge); });
+
+            shared_ptr<N> node = nodes[index];
+            int last = nodes.size() - 1;
+            if (index != last) {
+                nodes[index].swap(nodes[last]);
+                nodeIndex[nodes[index]->getLabel()] = index;
+                edges[index].swap(edges[last]);
+                for (auto& row : edges) row[index].swap(row[last]);
             }
-            return nullptr;
+            nodes.pop_back();
+            edges.pop_back();
+            for (auto& row : edges) row.pop_back();
+            nodeIndex.erase(label);
+            this->fingerprint -= nodeFingerprint(label);
+            this->epoch.advance();
+            this->dropComponents();
+            STELLA_STAT_SUCCEED(timer);
+            return node;
+        }
+        // Edge labels are only unique within a cell, so edges are removed by label and nodes.
+        shared_ptr<E> removeEdge(string label, string n1, string n2) override {
+            STELLA_STAT_TIMER(timer, edgeRemovals);
+            int node1 = getNodeIndex(n1);
+            int node2 = getNodeIndex(n2);
+            if (node1 < 0 || node2 < 0)
+                throw invalid_argument("Node labels not found: " + n1 + " " + n2);
+            map<string, shared_ptr<E>>& cell = edges[node1][node2];
+            auto it = cell.find(label);
+            if (it == cell.end())
+                throw invalid_argument("Edge not found: " + label + " " + n1 + " " + n2);
+            shared_ptr<E> edge = it->second;
+            unlinkEdge(node1, node2, label);
+            uncountEdge(*edge);
+            this->dropComponents();
+            STELLA_STAT_SUCCEED(timer);
+            return edge;
+        }
+        // Rows are moved whole, then the cells of each row are swapped into place: O(V^2)
+        // moves of cell maps, with one spare row of memory.
+        void permuteNodes(const vector<int64_t>& order) override {
+            this->checkPermutation(order);
+            size_t size = nodes.size();
+            vector<shared_ptr<N>> permuted(size);
+            vector<vector<map<string, shared_ptr<E>>>> rows(size);
+            for (size_t i = 0; i < size; i++) {
+                permuted[i].swap(nodes[order[i]]);
+                rows[i].swap(edges[order[i]]);
+                nodeIndex[permuted[i]->getLabel()] = i;
+            }
+            vector<map<string, shared_ptr<E>>> cells;
+            for (auto& row : rows) {
+                cells.clear();
+                cells.resize(size);
+                for (size_t j = 0; j < size; j++) cells[j].swap(row[order[j]]);
+                row.swap(cells);
+            }
+            nodes.swap(permuted);
+            edges.swap(rows);
+            this->epoch.advance();
+            this->dropComponents();
+        }
+        // Fills the empty `subgraph` with copies of the nodes at `selected` indices, in that
+        // order (repeats are skipped), and of the edges between them, copying the K x K
+        // cells of the selection without per edge checks. See subgraph.tpp.
+        void extractSubgraph(const vector<int>& selected, AdjMatrix<N, E>& subgraph) {
+            if (!subgraph.nodes.empty())
+                throw invalid_argument("Subgraph must be empty");
+            vector<char> seen(nodes.size(), 0);
+            vector<int> kept;
+            kept.reserve(selected.size());
+            subgraph.reserve(selected.size(), 0);
+            for (int index : selected) {
+                if (index < 0 || index >= (int) nodes.size())
+                    throw invalid_argument("Node index out of range: " + std::to_string(index));
+                if (seen[index]) continue;
+                seen[index] = 1;
+                kept.push_back(index);
+                const string& label = nodes[index]->getLabel();
+                subgraph.nodeIndex.emplace(label, subgraph.nodes.size());
+                subgraph.nodes.push_back(make_shared<N>(label));
+                subgraph.fingerprint += nodeFingerprint(label);
+            }
+            int size = kept.size();
+            subgraph.growMatrix(size);
+
+            // Non-directed edges are taken from the upper triangle and stored in both halves.
+            for (int i = 0; i < size; i++) {
+                for (int j = is_directed<E>::value ? 0 : i; j < size; j++) {
+                    for (auto& pair : edges[kept[i]][kept[j]]) {
+                        const shared_ptr<E>& edge = pair.second;
+                        bool forward = edge->getN1()->getLabel() == nodes[kept[i]]->getLabel();
+                        int n1 = forward ? i : j, n2 = forward ? j : i;
+                        shared_ptr<E> copy = make_shared<E>(edge->getLabel(),
+                            subgraph.nodes[n1], subgraph.nodes[n2], edge->getWeight());
+                        auto& cell = subgraph.edges[i][j];
+                        cell.emplace_hint(cell.end(), pair.first, copy);
+                        if (!is_directed<E>::value && i != j) {
+                            auto& mirror = subgraph.edges[j][i];
+                            mirror.emplace_hint(mirror.end(), pair.first, copy);
+                        }
+                        subgraph.edgeCount++;
+                        subgraph.fingerprint += edgeFingerprint(*copy);
+                    }
+                }
+            }
+            subgraph.epoch.advance();
         }
-        int getNodeIndex(std::string label) {
-            auto it = nodes.begin();
-            int index = 0;
-            while (it != nodes.end()) {
-                if ((*it)->getLabel() == label) return index;
-                ++it;
-                ++index;
+        // Releases the rows, cells and node slots left over by removals.
+        void compact() {
+            nodes.shrink_to_fit();
+            edges.shrink_to_fit();
+            for (auto& row : edges) row.shrink_to_fit();
+        }
+        // Calls `visit(edge)` once for every edge touching the node: its row, plus its
+        // column for directed edges. Costs O(V), the length of a row.
+        template<typename F>
+        void forEachIncidentEdge(const string& label, F visit) {
+            int index = getNodeIndex(label);
+            if (index < 0) return;
+            int size = nodes.size();
+            for (int j = 0; j < size; j++) {
+                for (auto& pair : edges[index][j]) visit(pair.second);
+                if (is_directed<E>::value && j != index)
+                    for (auto& pair : edges[j][index]) visit(pair.second);
             }
+        }
+        shared_ptr<N> getNode(std::string label) {
+            STELLA_STAT_TIMER(timer, nodeLookups);
+            auto it = nodeIndex.find(label);
+            STELLA_STAT_RESULT(timer, it != nodeIndex.end());
+            if (it != nodeIndex.end()) return nodes[it->second];
+            return nullptr;
+        }
+        int getNodeIndex(const std::string& label) const {
+            auto it = nodeIndex.find(label);
+            if (it != nodeIndex.end()) return it->second;
             return -1;
         };
         vector<std::shared_ptr<N>>& getAllNodes() override {
@@ -96,34 +370,57 @@ namespace stella {
         vector<vector<std::map<string, shared_ptr<E>>>>& getAllEdges() {
             return edges;
         }
-        friend bool operator==(AdjMatrix<N,E>& first, AdjMatrix<N,E>& second) {
-            if (first.nodes.size() != second.nodes.size()) return false;
-            for (int i = 0; i < first.nodes.size(); i++) {
-                bool node_present = false;
-                for (int j = 0; j < second.nodes.size(); j++) {
-                    if (*(first.nodes[i]) == *(second.nodes[j])) {
-                        node_present = true;
-                        break;
-                    };
+        // Every cell is a map, so an empty V x V matrix already costs V² map headers.
+        MemoryUsage memoryUsage() override {
+            MemoryUsage usage = Graph<N, E>::memoryUsage();
+            usage.containers += hashTableSize(nodeIndex);
+            for (const auto& pair : nodeIndex) usage.labels += labelBytes(pair.first);
+            usage.matrixCells += vectorSize(edges);
+            for (const auto& row : edges) {
+                usage.matrixCells += vectorSize(row);
+                for (const auto& cell : row) {
+                    usage.matrixCells += cell.size() * treeNodeSize<map<string, shared_ptr<E>>>();
+                    for (const auto& pair : cell) usage.labels += labelBytes(pair.first);
                 }
-                if (!node_present) return false;
             }
-            int size = first.nodes.size();
+            forEachEdge([&](const shared_ptr<E>& edge) {
+                addShared<E>(usage, usage.edges);
+                usage.labels += labelBytes(edge->label);
+            });
+            return usage;
+        }
+        // Calls `visit(edge)` once for every edge. Non-directed edges are stored in both
+        // halves of the matrix, so only the upper triangle is visited for them.
+        template<typename F>
+        void forEachEdge(F visit) {
+            int size = nodes.size();
             for (int i = 0; i < size; i++) {
-                for (int j = size - 1; j >= i; j--) {
-                    map<string, shared_ptr<E>>& firstEdgeMap = first.edges[i][j];
-                    map<string, shared_ptr<E>>& secondEdgeMap = second.edges[i][j];
-                    if (firstEdgeMap.size() != secondEdgeMap.size()) return false;
-                    for (const auto& firstPair : firstEdgeMap) {
-                        auto secondPair = secondEdgeMap.find(firstPair.first);
-
-                        if (secondPair == secondEdgeMap.end()) return false;
-
-                        if (*(firstPair.second) != *(secondPair->second)) return false;
-                    }
+                for (int j = is_directed<E>::value ? 0 : i; j < size; j++) {
+                    for (auto& pair : edges[i][j]) visit(pair.second);
                 }
             }
-            return true;
+        }
+        // Equal node labels and equal edges between the same nodes, whatever the order
+        // the nodes were added in. The fingerprints reject most unequal graphs in O(1);
+        // otherwise each edge of `first` is looked up in the matching cell of `second`,
+        // which reads every cell of `first`: O(V^2) like the matrix, not linear in E.
+        friend bool operator==(AdjMatrix<N,E>& first, AdjMatrix<N,E>& second) {
+            if (first.fingerprint != second.fingerprint) return false;
+            if (first.nodes.size() != second.nodes.size()) return false;
+            if (first.edgeCount != second.edgeCount) return false;
+            for (const shared_ptr<N>& node : first.nodes) {
+                if (!second.nodeIndex.count(node->getLabel())) return false;
+            }
+            bool equal = true;
+            first.forEachEdge([&](const shared_ptr<E>& edge) {
+                if (!equal) return;
+                int n1 = second.getNodeIndex(edge->getN1()->getLabel());
+                int n2 = second.getNodeIndex(edge->getN2()->getLabel());
+                map<string, shared_ptr<E>>& cell = second.edges[n1][n2];
+                auto secondPair = cell.find(edge->getLabel());
+                equal = secondPair != cell.end() && !(*(secondPair->second) != *edge);
+            });
+            return equal;
         }
         friend bool operator!=(AdjMatrix<N,E>& first, AdjMatrix<N,E>& second) {
             return !(first == second);
@@ -132,75 +429,33 @@ namespace stella {
 
     template<typename N, typename E>
     class DirectedAdjMatrix : public AdjMatrix<N, E> {
-        static_assert(std::is_base_of<DirectedEdge, E>::value, "E must be of type stella::DirectedEdge for directed graphs");
+        static_assert(is_directed<E>::value, "E must be of type stella::BasicDirectedEdge for directed graphs");
+    protected:
+        void linkEdge(int n1, int n2, shared_ptr<E> edge) override {
+            if (!this->edges[n1][n2].insert({edge->getLabel(), edge}).second) return;
+            this->countEdge(*edge);
+            this->trackEdge(n1, n2);
+        }
+        void unlinkEdge(int n1, int n2, const string& label) override {
+            this->edges[n1][n2].erase(label);
+        }
     public:
         DirectedAdjMatrix() : AdjMatrix<N, E>() {}
+        explicit DirectedAdjMatrix(AdjList<N, E>& list) : AdjMatrix<N, E>(list) {}
         void addNode(shared_ptr<N> node) {
-            if (this->getNode(node->getLabel()))
+            STELLA_STAT_TIMER(timer, nodeInserts);
+            if (this->nodeIndex.count(node->getLabel()))
                 throw invalid_argument("Node already exists: " + node->getLabel());
-            this->nodes.push_back(node);
-            this->pushNode(this->nodes.size());
+            this->insertNode(node);
+            STELLA_STAT_SUCCEED(timer);
         }
         void addNode(std::string label) {
-            if (this->getNode(label))
+            STELLA_STAT_TIMER(timer, nodeInserts);
+            if (this->nodeIndex.count(label))
                 throw invalid_argument("Node already exists: " + label);
             shared_ptr<N> node = make_shared<N>(label);
-            this->nodes.push_back(node);
-            this->pushNode(this->nodes.size());
-        }
-        void addEdge(shared_ptr<E> edge) {
-            int n1 = this->getNodeIndex(edge->getN1()->getLabel());
-            int n2 = this->getNodeIndex(edge->getN2()->getLabel());
-            if (n1 < 0 || n2 < 0)
-                throw invalid_argument("Node labels not found: "
-                    + edge->getN1()->getLabel() + " " + edge->getN2()->getLabel());
-            this->edges[n1][n2].insert({edge->getLabel(), edge});
-        }
-        void addEdge(string label, string n1, string n2) {
-            int node1 = this->getNodeIndex(n1);
-            int node2 = this->getNodeIndex(n2);
-            if (node1 < 0 || node2 < 0)
-                throw invalid_argument("Node labels not found: " + n1 + " " + n2);
-            shared_ptr<E> edge = make_shared<E>(label, this->nodes[node1], this->nodes[node2], 1);
-            this->edges[node1][node2].insert({edge->getLabel(), edge});
-        }
-
-        void addEdge(string label, string n1, string n2, int weight) {
-            int node1 = this->getNodeIndex(n1);
-            int node2 = this->getNodeIndex(n2);
-            if (node1 < 0 || node2 < 0)
-                throw invalid_argument("Node labels not found: " + n1 + " " + n2);
-            shared_ptr<E> edge = make_shared<E>(label, this->nodes[node1], this->nodes[node2], weight);
-            this->edges[node1][node2].insert({edge->getLabel(), edge});
-        }
-        friend bool operator==(DirectedAdjMatrix<N,E>& first, DirectedAdjMatrix<N,E>& second) {
-            if (first.nodes.size() != second.nodes.size()) return false;
-            for (int i = 0; i < first.nodes.size(); i++) {
-                bool node_present = false;
-                for (int j = 0; j < second.nodes.size(); j++) {
-                    if (*(first.nodes[i]) == *(second.nodes[j])) {
-                        node_present = true;
-                        break;
-                    };
-                }
-                if (!node_present) return false;
-            }
-            int size = first.nodes.size();
-            for (int i = 0; i < size; i++) {
-                for (int j = 0; j < size; j++) {
-                    map<string, shared_ptr<E>>& firstEdgeMap = first.edges[i][j];
-                    map<string, shared_ptr<E>>& secondEdgeMap = second.edges[i][j];
-                    if (firstEdgeMap.size() != secondEdgeMap.size()) return false;
-                    for (const auto& firstPair : firstEdgeMap) {
-                        auto secondPair = secondEdgeMap.find(firstPair.first);
-
-                        if (secondPair == secondEdgeMap.end()) return false;
-
-                        if (*(firstPair.second) != *(secondPair->second)) return false;
-                    }
-                }
-            }
-            return true;
+            this->insertNode(node);
+            STELLA_STAT_SUCCEED(timer);
         }
     };
 }
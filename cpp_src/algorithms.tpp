@@ -0,0 +1,248 @@
+#ifndef ALGORITHMS_TPP
+#define ALGORITHMS_TPP
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "csr.tpp"
+#include "parallel.tpp"
+
+using std::atomic;
+using std::int64_t;
+using std::invalid_argument;
+using std::pair;
+using std::string;
+using std::vector;
+
+namespace stella {
+    /*
+        Traversal and analytics routines. They all run on the CSR form of a graph
+        (see csr.tpp) and take node indices, so they never touch the node and edge
+        objects. Each takes a thread count; 0 means one per hardware thread.
+        Unreachable nodes get a distance and a predecessor of -1.
+
+        They are templates over the weight type `C` of the CSR, so shortest paths
+        add up int64_t or double costs following the edge weights of the graph.
+    */
+
+    template<typename C>
+    void checkSource(const BasicCSR<C>& csr, int64_t source) {
+        if (source < 0 || source >= csr.nodeCount())
+            throw invalid_argument("Source node index out of range: " + std::to_string(source));
+    }
+
+    // Hop distance from `source` to every node. Each BFS level is split across the threads.
+    template<typename C>
+    vector<int64_t> bfsDistances(const BasicCSR<C>& csr, int64_t source, unsigned threads = 1) {
+        checkSource(csr, source);
+        int64_t nodeCount = csr.nodeCount();
+        vector<atomic<int64_t>> distances(nodeCount);
+        for (atomic<int64_t>& distance : distances) distance.store(-1, std::memory_order_relaxed);
+        distances[source].store(0, std::memory_order_relaxed);
+
+        vector<int64_t> frontier(1, source);
+        vector<vector<int64_t>> next(resolveThreads(threads));
+        for (int64_t level = 1; !frontier.empty(); level++) {
+            parallelFor(frontier.size(), threads, 1024, [&](size_t begin, size_t end, unsigned thread) {
+                vector<int64_t>& found = next[thread];
+                for (size_t i = begin; i < end; i++) {
+                    int64_t node = frontier[i];
+                    for (int64_t e = csr.offsets[node]; e < csr.offsets[node + 1]; e++) {
+                        atomic<int64_t>& distance = distances[csr.targets[e]];
+                        int64_t unvisited = -1;
+                        if (distance.load(std::memory_order_relaxed) == -1
+                            && distance.compare_exchange_strong(unvisited, level, std::memory_order_relaxed))
+                            found.push_back(csr.targets[e]);
+                    }
+                }
+            });
+            frontier.clear();
+            for (vector<int64_t>& found : next) {
+                frontier.insert(frontier.end(), found.begin(), found.end());
+                found.clear();
+            }
+        }
+
+        vector<int64_t> result(nodeCount);
+        for (int64_t i = 0; i < nodeCount; i++) result[i] = distances[i].load(std::memory_order_relaxed);
+        return result;
+    }
+
+    /*
+        Dijkstra from every source: row `i` of `distances` and `predecessors` holds the
+        result for `sources[i]`, each row `nodeCount()` long. Sources are split across
+        the threads. Weights must not be negative.
+    */
+    template<typename C>
+    struct BasicShortestPaths {
+        vector<C> distances;
+        vector<int64_t> predecessors;
+    };
+
+    typedef BasicShortestPaths<int64_t> ShortestPaths;
+
+    template<typename C>
+    void dijkstra(const BasicCSR<C>& csr, int64_t source, C* distances, int64_t* predecessors) {
+        typedef pair<C, int64_t> Entry;
+        std::priority_queue<Entry, vector<Entry>, std::greater<Entry>> queue;
+        distances[source] = 0;
+        queue.emplace(0, source);
+        while (!queue.empty()) {
+            Entry top = queue.top();
+            queue.pop();
+            int64_t node = top.second;
+            if (top.first > distances[node]) continue;
+            for (int64_t e = csr.offsets[node]; e < csr.offsets[node + 1]; e++) {
+                int64_t target = csr.targets[e];
+                C distance = top.first + csr.weights[e];
+                if (distances[target] == -1 || distance < distances[target]) {
+                    distances[target] = distance;
+                    predecessors[target] = node;
+                    queue.emplace(distance, target);
+                }
+            }
+        }
+    }
+
+    template<typename C>
+    BasicShortestPaths<C> shortestPaths(const BasicCSR<C>& csr, const vector<int64_t>& sources, unsigned threads = 1) {
+        for (int64_t source : sources) checkSource(csr, source);
+        for (C weight : csr.weights)
+            if (weight < 0) throw invalid_argument("Shortest paths require non-negative edge weights");
+
+        size_t nodeCount = csr.nodeCount();
+        BasicShortestPaths<C> paths;
+        paths.distances.assign(sources.size() * nodeCount, -1);
+        paths.predecessors.assign(sources.size() * nodeCount, -1);
+        parallelFor(sources.size(), threads, 1, [&](size_t begin, size_t end, unsigned thread) {
+            for (size_t i = begin; i < end; i++)
+                dijkstra(csr, sources[i], &paths.distances[i * nodeCount], &paths.predecessors[i * nodeCount]);
+        });
+        return paths;
+    }
+
+    /*
+        Connected components, weakly connected for directed graphs. Nodes are merged
+        with a lock-free union-find that always links the larger root below the
+        smaller one, so each root is the lowest index of its component. Components
+        are numbered 0, 1, ... in the order of their lowest node index.
+    */
+    template<typename C>
+    vector<int64_t> connectedComponents(const BasicCSR<C>& csr, unsigned threads = 1) {
+        int64_t nodeCount = csr.nodeCount();
+        vector<atomic<int64_t>> parent(nodeCount);
+        for (int64_t i = 0; i < nodeCount; i++) parent[i].store(i, std::memory_order_relaxed);
+
+        auto find = [&parent](int64_t node) {
+            int64_t up;
+            while ((up = parent[node].load()) != node) {
+                // Path halving; any ancestor is a valid parent for a node that is not a root.
+                int64_t grandparent = parent[up].load();
+                if (grandparent != up) parent[node].store(grandparent);
+                node = up;
+            }
+            return node;
+        };
+
+        parallelFor(nodeCount, threads, 1024, [&](size_t begin, size_t end, unsigned thread) {
+            for (size_t node = begin; node < end; node++) {
+                for (int64_t e = csr.offsets[node]; e < csr.offsets[node + 1]; e++) {
+                    int64_t a = node, b = csr.targets[e];
+                    while (true) {
+                        a = find(a);
+                        b = find(b);
+                        if (a == b) break;
+                        if (a < b) std::swap(a, b);
+                        int64_t root = a;
+                        if (parent[a].compare_exchange_strong(root, b)) break;
+                    }
+                }
+            }
+        });
+
+        vector<int64_t> labels(nodeCount);
+        int64_t count = 0;
+        for (int64_t i = 0; i < nodeCount; i++) {
+            int64_t root = find(i);
+            labels[i] = root == i ? count++ : labels[root];
+        }
+        return labels;
+    }
+
+    // Same adjacency with every edge reversed.
+    template<typename C>
+    BasicCSR<C> transpose(const BasicCSR<C>& csr) {
+        int64_t nodeCount = csr.nodeCount();
+        BasicCSR<C> reversed;
+        reversed.offsets.assign(nodeCount + 1, 0);
+        for (int64_t target : csr.targets) reversed.offsets[target + 1]++;
+        for (int64_t i = 0; i < nodeCount; i++) reversed.offsets[i + 1] += reversed.offsets[i];
+
+        reversed.targets.resize(csr.targets.size());
+        reversed.weights.resize(csr.weights.size());
+        vector<int64_t> next(reversed.offsets.begin(), reversed.offsets.end() - 1);
+        for (int64_t node = 0; node < nodeCount; node++) {
+            for (int64_t e = csr.offsets[node]; e < csr.offsets[node + 1]; e++) {
+                int64_t slot = next[csr.targets[e]]++;
+                reversed.targets[slot] = node;
+                reversed.weights[slot] = csr.weights[e];
+            }
+        }
+        return reversed;
+    }
+
+    /*
+        Unweighted PageRank by power iteration, pulling along `incoming` (the transpose
+        of `csr`, or `csr` itself when it is symmetric). The rank of dangling nodes is
+        spread evenly over all nodes. Stops after `iterations` rounds or once the L1
+        change of a round drops below `tolerance`.
+    */
+    template<typename C>
+    vector<double> pageRank(const BasicCSR<C>& csr, const BasicCSR<C>& incoming, double damping = 0.85,
+        int iterations = 100, double tolerance = 1e-6, unsigned threads = 1) {
+        int64_t nodeCount = csr.nodeCount();
+        if (nodeCount == 0) return vector<double>();
+        if (damping < 0 || damping > 1) throw invalid_argument("PageRank damping must be between 0 and 1");
+
+        vector<double> rank(nodeCount, 1.0 / nodeCount), next(nodeCount), share(nodeCount);
+        vector<double> partial(resolveThreads(threads));
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            std::fill(partial.begin(), partial.end(), 0.0);
+            parallelFor(nodeCount, threads, 4096, [&](size_t begin, size_t end, unsigned thread) {
+                for (size_t node = begin; node < end; node++) {
+                    int64_t degree = csr.offsets[node + 1] - csr.offsets[node];
+                    share[node] = degree ? rank[node] / degree : 0.0;
+                    if (!degree) partial[thread] += rank[node];
+                }
+            });
+            double dangling = 0;
+            for (double sum : partial) dangling += sum;
+            double base = (1 - damping) / nodeCount + damping * dangling / nodeCount;
+
+            std::fill(partial.begin(), partial.end(), 0.0);
+            parallelFor(nodeCount, threads, 4096, [&](size_t begin, size_t end, unsigned thread) {
+                for (size_t node = begin; node < end; node++) {
+                    double sum = 0;
+                    for (int64_t e = incoming.offsets[node]; e < incoming.offsets[node + 1]; e++)
+                        sum += share[incoming.targets[e]];
+                    next[node] = base + damping * sum;
+                    partial[thread] += std::fabs(next[node] - rank[node]);
+                }
+            });
+            rank.swap(next);
+            double change = 0;
+            for (double sum : partial) change += sum;
+            if (change < tolerance) break;
+        }
+        return rank;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,260 @@
+#ifndef COMPRESSED_CSR_TPP
+#define COMPRESSED_CSR_TPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "csr.tpp"
+#include "memory.hpp"
+
+using std::int64_t;
+using std::invalid_argument;
+using std::pair;
+using std::uint8_t;
+using std::uint64_t;
+using std::vector;
+
+namespace stella {
+    // LEB128: 7 bits per byte, low bits first, the high bit set on all bytes but the last.
+    inline void putVarint(vector<uint8_t>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(uint8_t(value) | 0x80);
+            value >>= 7;
+        }
+        out.push_back(uint8_t(value));
+    }
+
+    inline uint64_t getVarint(const uint8_t*& in) {
+        uint64_t value = *in & 0x7f;
+        unsigned shift = 7;
+        while (*in++ & 0x80) {
+            value |= uint64_t(*in & 0x7f) << shift;
+            shift += 7;
+        }
+        return value;
+    }
+
+    // Small negative numbers as small varints: 0, -1, 1, -2... become 0, 1, 2, 3...
+    inline uint64_t zigzag(int64_t value) {
+        return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+    }
+
+    inline int64_t unzigzag(uint64_t value) {
+        return int64_t(value >> 1) ^ -int64_t(value & 1);
+    }
+
+    // Integer weights are zigzag varints, floating point ones their raw bytes.
+    template<typename C>
+    void encodeWeight(vector<uint8_t>& out, C weight, std::true_type) {
+        putVarint(out, zigzag(weight));
+    }
+
+    template<typename C>
+    void encodeWeight(vector<uint8_t>& out, C weight, std::false_type) {
+        uint8_t bytes[sizeof(C)];
+        std::memcpy(bytes, &weight, sizeof(C));
+        out.insert(out.end(), bytes, bytes + sizeof(C));
+    }
+
+    template<typename C>
+    C decodeWeight(const uint8_t*& in, std::true_type) {
+        return C(unzigzag(getVarint(in)));
+    }
+
+    template<typename C>
+    C decodeWeight(const uint8_t*& in, std::false_type) {
+        C weight;
+        std::memcpy(&weight, in, sizeof(C));
+        in += sizeof(C);
+        return weight;
+    }
+
+    /*
+        Read-only CSR adjacency with every row compressed: the targets are sorted and
+        stored as gaps, in byte-aligned varints, so a row of nearby neighbors costs
+        about one byte per edge. Each row starts with its degree, and the first target
+        is stored relative to the node itself. Weights follow their target, and are not
+        stored at all when every weight is 1. A byte offset per node gives random access
+        to any row.
+
+        Rows are decoded while iterating, so neighbors are read straight from the
+        compressed bytes without a decompressed copy. Reordering the nodes first
+        (reorder.tpp) gives smaller gaps, and so a smaller graph.
+    */
+    template<typename C>
+    class BasicCompressedCSR {
+        public:
+            struct Neighbor {
+                int64_t target;
+                C weight;
+            };
+
+            class NeighborIterator {
+                protected:
+                    const uint8_t* in;
+                    int64_t remaining;
+                    bool weighted;
+                    bool first = true;
+                    Neighbor current;
+                    void decode() {
+                        if (first) current.target += unzigzag(getVarint(in));
+                        else current.target += getVarint(in);
+                        first = false;
+                        if (weighted) current.weight = decodeWeight<C>(in, std::is_integral<C>());
+                    }
+                public:
+                    NeighborIterator(const uint8_t* in, int64_t remaining, int64_t node, bool weighted)
+                        : in(in), remaining(remaining), weighted(weighted), current{node, C(1)} {
+                        if (remaining > 0) decode();
+                    }
+                    const Neighbor& operator*() const { return current; }
+                    const Neighbor* operator->() const { return &current; }
+                    NeighborIterator& operator++() {
+                        if (--remaining > 0) decode();
+                        return *this;
+                    }
+                    bool operator!=(const NeighborIterator& other) const { return remaining != other.remaining; }
+                    bool operator==(const NeighborIterator& other) const { return remaining == other.remaining; }
+            };
+
+            class NeighborRange {
+                protected:
+                    const uint8_t* in;
+                    int64_t degree;
+                    int64_t node;
+                    bool weighted;
+                public:
+                    NeighborRange(const uint8_t* in, int64_t degree, int64_t node, bool weighted)
+                        : in(in), degree(degree), node(node), weighted(weighted) {}
+                    NeighborIterator begin() const { return NeighborIterator(in, degree, node, weighted); }
+                    NeighborIterator end() const { return NeighborIterator(in, 0, node, weighted); }
+                    int64_t size() const { return degree; }
+            };
+        protected:
+            // Byte offset of each row in `data`, plus the end of the last one.
+            vector<uint64_t> offsets;
+            vector<uint8_t> data;
+            bool weighted;
+            size_t edgeCount = 0;
+        public:
+            // Rows are then added in node order with appendRow.
+            BasicCompressedCSR(bool weighted = true) : offsets(1, 0), weighted(weighted) {}
+
+            // Sorts `neighbors` in place and encodes them as the next row. Building row by
+            // row never holds more than one uncompressed row in memory.
+            void appendRow(vector<pair<int64_t, C>>& neighbors) {
+                int64_t node = nodeCount();
+                std::sort(neighbors.begin(), neighbors.end());
+                putVarint(data, neighbors.size());
+                int64_t previous = node;
+                for (size_t i = 0; i < neighbors.size(); i++) {
+                    int64_t target = neighbors[i].first;
+                    if (target < 0) throw invalid_argument("Negative target in row " + std::to_string(node));
+                    if (i == 0) putVarint(data, zigzag(target - previous));
+                    else putVarint(data, target - previous);
+                    previous = target;
+                    if (weighted) encodeWeight(data, neighbors[i].second, std::is_integral<C>());
+                }
+                offsets.push_back(data.size());
+                edgeCount += neighbors.size();
+            }
+            // Releases the spare capacity once every row is in.
+            void shrinkToFit() {
+                offsets.shrink_to_fit();
+                data.shrink_to_fit();
+            }
+
+            int64_t nodeCount() const {
+                return offsets.size() - 1;
+            }
+            size_t getEdgeCount() const {
+                return edgeCount;
+            }
+            bool isWeighted() const {
+                return weighted;
+            }
+            int64_t degree(int64_t node) const {
+                const uint8_t* in = data.data() + offsets[node];
+                return getVarint(in);
+            }
+            NeighborRange neighbors(int64_t node) const {
+                const uint8_t* in = data.data() + offsets[node];
+                int64_t count = getVarint(in);
+                return NeighborRange(in, count, node, weighted);
+            }
+            // Calls `visit(target, weight)` for every neighbor of `node`, by increasing target.
+            template<typename F>
+            void forEachNeighbor(int64_t node, F visit) const {
+                for (const Neighbor& neighbor : neighbors(node)) visit(neighbor.target, neighbor.weight);
+            }
+            size_t heapBytes() const {
+                return vectorSize(offsets) + vectorSize(data);
+            }
+            BasicCSR<C> decompress() const {
+                BasicCSR<C> csr;
+                csr.offsets.reserve(offsets.size());
+                csr.offsets.push_back(0);
+                csr.targets.reserve(edgeCount);
+                csr.weights.reserve(edgeCount);
+                for (int64_t node = 0; node < nodeCount(); node++) {
+                    for (const Neighbor& neighbor : neighbors(node)) {
+                        csr.targets.push_back(neighbor.target);
+                        csr.weights.push_back(neighbor.weight);
+                    }
+                    csr.offsets.push_back(csr.targets.size());
+                }
+                return csr;
+            }
+    };
+
+    template<typename C>
+    BasicCompressedCSR<C> compress(const BasicCSR<C>& csr) {
+        bool weighted = false;
+        for (C weight : csr.weights) weighted = weighted || weight != C(1);
+        BasicCompressedCSR<C> compressed(weighted);
+        vector<pair<int64_t, C>> row;
+        for (int64_t node = 0; node < csr.nodeCount(); node++) {
+            row.clear();
+            for (int64_t e = csr.offsets[node]; e < csr.offsets[node + 1]; e++)
+                row.emplace_back(csr.targets[e], csr.weights[e]);
+            compressed.appendRow(row);
+        }
+        compressed.shrinkToFit();
+        return compressed;
+    }
+
+    typedef BasicCompressedCSR<int64_t> CompressedCSR;
+
+    template<typename G>
+    BasicCompressedCSR<GraphCost<G>> toCompressedCSR(G& graph) {
+        return compress(toCSR(graph));
+    }
+
+    // Same as bfsDistances on a CSR, decoding the rows as it goes.
+    template<typename C>
+    vector<int64_t> bfsDistances(const BasicCompressedCSR<C>& csr, int64_t source) {
+        if (source < 0 || source >= csr.nodeCount())
+            throw invalid_argument("Source node index out of range: " + std::to_string(source));
+        vector<int64_t> distances(csr.nodeCount(), -1);
+        vector<int64_t> queue;
+        queue.reserve(csr.nodeCount());
+        distances[source] = 0;
+        queue.push_back(source);
+        for (size_t head = 0; head < queue.size(); head++) {
+            int64_t node = queue[head];
+            for (const typename BasicCompressedCSR<C>::Neighbor& neighbor : csr.neighbors(node)) {
+                if (distances[neighbor.target] >= 0) continue;
+                distances[neighbor.target] = distances[node] + 1;
+                queue.push_back(neighbor.target);
+            }
+        }
+        return distances;
+    }
+}
+
+#endif
\ No newline at end of file
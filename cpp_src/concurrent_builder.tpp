@@ -0,0 +1,167 @@
+#ifndef CONCURRENT_BUILDER_TPP
+#define CONCURRENT_BUILDER_TPP
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "graph.tpp"
+#include "parallel.tpp"
+
+using std::invalid_argument;
+using std::mutex;
+using std::string;
+using std::uint64_t;
+using std::unordered_map;
+using std::unordered_set;
+using std::vector;
+
+namespace stella {
+    /*
+        Collects nodes and edges from many threads at once, then `seal()`s them into
+        a graph of type `G` (AdjList, AdjMatrix or their directed versions).
+
+        Node labels and edge labels are spread over shards by hash, each shard with its
+        own lock, so threads only wait for each other when they hit the same shard.
+        An edge is appended to the shard of its label, under the lock already taken to
+        check that label, so edge storage needs no lock of its own.
+
+        The usual rules hold and are checked as items arrive: labels are unique and
+        both ends of an edge must already be in the builder. Which node gets which
+        index in the sealed graph depends on the shards, not on insertion order.
+    */
+    template<typename G>
+    class ConcurrentBuilder {
+        public:
+            using Weight = typename G::Weight;
+        protected:
+            // Node ids keep the shard in their low bits and the position inside it above them.
+            struct alignas(64) NodeShard {
+                mutex lock;
+                unordered_map<string, uint64_t> index;
+                vector<string> labels;
+            };
+            struct EdgeRecord {
+                string label;
+                uint64_t n1;
+                uint64_t n2;
+                Weight weight;
+            };
+            struct alignas(64) EdgeShard {
+                mutex lock;
+                unordered_set<string> labels;
+                vector<EdgeRecord> edges;
+            };
+
+            unsigned shardBits;
+            vector<NodeShard> nodeShards;
+            vector<EdgeShard> edgeShards;
+
+            size_t shardOf(const string& label) const {
+                // The high bits, as the shard maps use the low ones for their buckets.
+                uint64_t hash = std::hash<string>()(label);
+                return shardBits == 0 ? 0 : (hash * 0x9e3779b97f4a7c15ULL) >> (64 - shardBits);
+            }
+            uint64_t findNode(const string& label) {
+                NodeShard& shard = nodeShards[shardOf(label)];
+                std::lock_guard<mutex> guard(shard.lock);
+                auto it = shard.index.find(label);
+                return it == shard.index.end() ? UINT64_MAX : it->second;
+            }
+            const string& nodeLabel(uint64_t id) const {
+                return nodeShards[id & ((uint64_t(1) << shardBits) - 1)].labels[id >> shardBits];
+            }
+        public:
+            // 0 shards picks four per hardware thread; the count is rounded up to a power of two.
+            ConcurrentBuilder(unsigned shards = 0) : shardBits(0) {
+                if (shards == 0) shards = 4 * resolveThreads(0);
+                while ((1u << shardBits) < shards) shardBits++;
+                nodeShards = vector<NodeShard>(size_t(1) << shardBits);
+                edgeShards = vector<EdgeShard>(size_t(1) << shardBits);
+            }
+            ConcurrentBuilder(const ConcurrentBuilder&) = delete;
+            ConcurrentBuilder& operator=(const ConcurrentBuilder&) = delete;
+
+            void addNode(const string& label) {
+                size_t index = shardOf(label);
+                NodeShard& shard = nodeShards[index];
+                std::lock_guard<mutex> guard(shard.lock);
+                uint64_t id = (uint64_t(shard.labels.size()) << shardBits) | index;
+                if (!shard.index.emplace(label, id).second)
+                    throw invalid_argument("Node already exists: " + label);
+                shard.labels.push_back(label);
+            }
+            void addEdge(const string& label, const string& n1, const string& n2, Weight weight = Weight(1)) {
+                uint64_t node1 = findNode(n1);
+                uint64_t node2 = findNode(n2);
+                if (node1 == UINT64_MAX || node2 == UINT64_MAX)
+                    throw invalid_argument("Node labels not found: " + n1 + " " + n2);
+                EdgeShard& shard = edgeShards[shardOf(label)];
+                std::lock_guard<mutex> guard(shard.lock);
+                if (!shard.labels.insert(label).second)
+                    throw invalid_argument("Edge already exists: " + label);
+                shard.edges.push_back({label, node1, node2, weight});
+            }
+
+            // The counts are only exact while no thread is adding to the builder.
+            size_t getNodeCount() {
+                size_t count = 0;
+                for (NodeShard& shard : nodeShards) {
+                    std::lock_guard<mutex> guard(shard.lock);
+                    count += shard.labels.size();
+                }
+                return count;
+            }
+            size_t getEdgeCount() {
+                size_t count = 0;
+                for (EdgeShard& shard : edgeShards) {
+                    std::lock_guard<mutex> guard(shard.lock);
+                    count += shard.edges.size();
+                }
+                return count;
+            }
+
+            /*
+                Builds the graph through its bulk interface and empties the builder.
+                No thread may be adding to the builder while it runs; edges the graph
+                type itself refuses (parallel edges of an AdjMatrix, for one) still
+                throw here. Labels are copied out rather than moved, so when that
+                happens the builder is left untouched, with all its nodes and edges.
+            */
+            G seal() {
+                G graph;
+                vector<string> labels;
+                labels.reserve(getNodeCount());
+                for (NodeShard& shard : nodeShards)
+                    labels.insert(labels.end(), shard.labels.begin(), shard.labels.end());
+                vector<BasicEdgeEntry<Weight>> entries;
+                entries.reserve(getEdgeCount());
+                for (EdgeShard& shard : edgeShards) {
+                    for (const EdgeRecord& record : shard.edges)
+                        entries.push_back({record.label, nodeLabel(record.n1),
+                            nodeLabel(record.n2), record.weight});
+                }
+                graph.reserve(labels.size(), entries.size());
+                graph.addNodes(labels);
+                graph.addEdges(entries);
+
+                for (NodeShard& shard : nodeShards) {
+                    shard.index.clear();
+                    shard.labels.clear();
+                }
+                for (EdgeShard& shard : edgeShards) {
+                    shard.labels.clear();
+                    shard.edges.clear();
+                }
+                return graph;
+            }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+#ifndef CSR_TPP
+#define CSR_TPP
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "edge.hpp"
+
+using std::int64_t;
+using std::invalid_argument;
+using std::shared_ptr;
+using std::unordered_map;
+using std::vector;
+
+namespace stella {
+    // Weights are widened in the index based forms: integers to int64_t, floating point to double.
+    template<typename W>
+    struct weight_cost {
+        typedef typename std::conditional<std::is_floating_point<W>::value, double, int64_t>::type type;
+    };
+
+    template<typename G>
+    using GraphCost = typename weight_cost<typename G::Weight>::type;
+
+    /*
+        Index based (COO) view of the edges of a graph: edge `i` goes from node
+        `sources[i]` to node `targets[i]`, with indices following `getAllNodes()`.
+        Every edge appears once, also for non-directed graphs.
+    */
+    template<typename C>
+    struct BasicEdgeArrays {
+        vector<int64_t> sources;
+        vector<int64_t> targets;
+        vector<C> weights;
+    };
+
+    typedef BasicEdgeArrays<int64_t> EdgeArrays;
+
+    /*
+        Compressed sparse row adjacency: the neighbors of node `i` are
+        `targets[offsets[i]]` to `targets[offsets[i + 1] - 1]`.
+        Non-directed edges are stored in both rows, as SciPy expects.
+    */
+    template<typename C>
+    struct BasicCSR {
+        vector<int64_t> offsets;
+        vector<int64_t> targets;
+        vector<C> weights;
+        int64_t nodeCount() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    };
+
+    typedef BasicCSR<int64_t> CSR;
+
+    template<typename G>
+    BasicEdgeArrays<GraphCost<G>> toEdgeArrays(G& graph) {
+        auto& nodes = graph.getAllNodes();
+        unordered_map<const Node*, int64_t> index;
+        index.reserve(nodes.size());
+        for (size_t i = 0; i < nodes.size(); i++) index.emplace(nodes[i].get(), i);
+
+        // Edges added as objects may hold their own copy of a node, so fall back to the label.
+        auto indexOf = [&](const shared_ptr<Node>& node) -> int64_t {
+            auto it = index.find(node.get());
+            if (it != index.end()) return it->second;
+            int found = graph.getNodeIndex(node->getLabel());
+            if (found < 0) throw invalid_argument("Node labels not found: " + node->getLabel());
+            return found;
+        };
+
+        BasicEdgeArrays<GraphCost<G>> arrays;
+        graph.forEachEdge([&](const shared_ptr<typename G::EdgeType>& edge) {
+            arrays.sources.push_back(indexOf(edge->getN1()));
+            arrays.targets.push_back(indexOf(edge->getN2()));
+            arrays.weights.push_back(edge->getWeight());
+        });
+        return arrays;
+    }
+
+    template<typename G>
+    BasicCSR<GraphCost<G>> toCSR(G& graph) {
+        bool directed = is_directed<typename G::EdgeType>::value;
+        BasicEdgeArrays<GraphCost<G>> arrays = toEdgeArrays(graph);
+        size_t nodeCount = graph.getAllNodes().size();
+
+        BasicCSR<GraphCost<G>> csr;
+        csr.offsets.assign(nodeCount + 1, 0);
+        for (size_t i = 0; i < arrays.sources.size(); i++) {
+            csr.offsets[arrays.sources[i] + 1]++;
+            if (!directed && arrays.sources[i] != arrays.targets[i])
+                csr.offsets[arrays.targets[i] + 1]++;
+        }
+        for (size_t i = 0; i < nodeCount; i++) csr.offsets[i + 1] += csr.offsets[i];
+
+        csr.targets.resize(csr.offsets[nodeCount]);
+        csr.weights.resize(csr.offsets[nodeCount]);
+        vector<int64_t> next(csr.offsets.begin(), csr.offsets.end() - 1);
+        for (size_t i = 0; i < arrays.sources.size(); i++) {
+            int64_t slot = next[arrays.sources[i]]++;
+            csr.targets[slot] = arrays.targets[i];
+            csr.weights[slot] = arrays.weights[i];
+            if (!directed && arrays.sources[i] != arrays.targets[i]) {
+                slot = next[arrays.targets[i]]++;
+                csr.targets[slot] = arrays.sources[i];
+                csr.weights[slot] = arrays.weights[i];
+            }
+        }
+        return csr;
+    }
+
+    // Row major V x V matrix of weights. Parallel edges between the same pair of nodes are summed.
+    template<typename G>
+    vector<GraphCost<G>> toDense(G& graph) {
+        bool directed = is_directed<typename G::EdgeType>::value;
+        BasicEdgeArrays<GraphCost<G>> arrays = toEdgeArrays(graph);
+        size_t nodeCount = graph.getAllNodes().size();
+
+        vector<GraphCost<G>> dense(nodeCount * nodeCount, 0);
+        for (size_t i = 0; i < arrays.sources.size(); i++) {
+            dense[arrays.sources[i] * nodeCount + arrays.targets[i]] += arrays.weights[i];
+            if (!directed && arrays.sources[i] != arrays.targets[i])
+                dense[arrays.targets[i] * nodeCount + arrays.sources[i]] += arrays.weights[i];
+        }
+        return dense;
+    }
+}
+
+#endif
\ No newline at end of file
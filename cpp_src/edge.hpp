@@ -4,6 +4,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 using std::shared_ptr;
 using std::string;
@@ -12,44 +13,137 @@ using std::ostream;
 #include "node.hpp"
 
 namespace stella {
-    class BaseEdge {
+    /*
+        Edges are templates over their weight type `W`, e.g. `BasicEdge<double>` for
+        fractional costs or `BasicEdge<int64_t>` for large ones. `Edge`, `DirectedEdge`
+        and `BaseEdge` are the `int` versions used everywhere else.
+
+        `Unweighted` stores nothing: those edges are one `int` smaller, always report
+        a weight of 1, and ignore the weight given to their constructor.
+    */
+    struct Unweighted {};
+
+    // Type of the weights given to and returned by edges with weight type `W`.
+    template<typename W>
+    struct weight_value {
+        typedef W type;
+    };
+
+    template<>
+    struct weight_value<Unweighted> {
+        typedef int type;
+    };
+
+    template<typename W>
+    class EdgeWeight {
     public:
+        const W weight;
+        EdgeWeight(W weight) : weight(weight) {}
+        W getWeight() const { return weight; }
+    };
+
+    // Empty, so it takes no space as a base class.
+    template<>
+    class EdgeWeight<Unweighted> {
+    public:
+        EdgeWeight(int weight) {}
+        int getWeight() const { return 1; }
+    };
+
+    template<typename W>
+    class BasicBaseEdge: public EdgeWeight<W> {
+    public:
+        typedef W WeightType;
+        typedef typename weight_value<W>::type Weight;
+
         const string label;
         const shared_ptr<Node> n1;
         const shared_ptr<Node> n2;
-        const int weight;
-
-        BaseEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2, int weight);
-        BaseEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2);
-
-        string getLabel() const;
-        const shared_ptr<Node> getN1() const;
-        const shared_ptr<Node> getN2() const;
-        int getWeight() const;
-
-        friend ostream& operator<<(ostream& os, BaseEdge* object);
-        friend bool operator==(const BaseEdge& first, const BaseEdge& second);
-        friend bool operator!=(const BaseEdge& first, const BaseEdge& second);
-        friend bool operator>(const BaseEdge& first, const BaseEdge& second);
-        friend bool operator>=(const BaseEdge& first, const BaseEdge& second);
-        friend bool operator<(const BaseEdge& first, const BaseEdge& second);
-        friend bool operator<=(const BaseEdge& first, const BaseEdge& second);
+
+        BasicBaseEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2, Weight weight)
+            : EdgeWeight<W>(weight), label(label), n1(n1), n2(n2) {}
+        BasicBaseEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2)
+            : EdgeWeight<W>(Weight(1)), label(label), n1(n1), n2(n2) {}
+
+        string getLabel() const { return label; }
+        const shared_ptr<Node> getN1() const { return n1; }
+        const shared_ptr<Node> getN2() const { return n2; }
+
+        friend ostream& operator<<(ostream& os, BasicBaseEdge* object) {
+            os << object->label << ": " << object->n1->getLabel() << "-"
+               << object->n2->getLabel() << "(" << object->getWeight() << ")";
+            return os;
+        }
+        friend bool operator==(const BasicBaseEdge& first, const BasicBaseEdge& second) {
+            return (first.n1->getLabel() == second.n1->getLabel()
+                || first.n1->getLabel() == second.n2->getLabel())
+            && (first.n2->getLabel() == second.n2->getLabel()
+                || first.n2->getLabel() == second.n1->getLabel());
+        }
+        friend bool operator!=(const BasicBaseEdge& first, const BasicBaseEdge& second) {
+            return !(first == second);
+        }
+        friend bool operator>(const BasicBaseEdge& first, const BasicBaseEdge& second) {
+            return first.getWeight() > second.getWeight();
+        }
+        friend bool operator>=(const BasicBaseEdge& first, const BasicBaseEdge& second) {
+            return first.getWeight() >= second.getWeight();
+        }
+        friend bool operator<(const BasicBaseEdge& first, const BasicBaseEdge& second) {
+            return first.getWeight() < second.getWeight();
+        }
+        friend bool operator<=(const BasicBaseEdge& first, const BasicBaseEdge& second) {
+            return first.getWeight() <= second.getWeight();
+        }
     };
 
-    class Edge: public BaseEdge {
+    template<typename W>
+    class BasicEdge: public BasicBaseEdge<W> {
     public:
-        Edge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2, int weight);
-        Edge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2);
+        typedef typename BasicBaseEdge<W>::Weight Weight;
+        BasicEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2, Weight weight)
+            : BasicBaseEdge<W>(label, n1, n2, weight) {}
+        BasicEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2)
+            : BasicBaseEdge<W>(label, n1, n2) {}
     };
 
-    class DirectedEdge: public Edge {
+    template<typename W>
+    class BasicDirectedEdge: public BasicEdge<W> {
     public:
-        DirectedEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2, int weight);
-        DirectedEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2);
-        friend std::ostream& operator<<(std::ostream& os, DirectedEdge* object);
-        friend bool operator==(const DirectedEdge& first, const DirectedEdge& second);
-        friend bool operator!=(const DirectedEdge& first, const DirectedEdge& second);
+        typedef typename BasicBaseEdge<W>::Weight Weight;
+        BasicDirectedEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2, Weight weight)
+            : BasicEdge<W>(label, n1, n2, weight) {}
+        BasicDirectedEdge(string label, shared_ptr<Node> n1, shared_ptr<Node> n2)
+            : BasicEdge<W>(label, n1, n2) {}
+
+        friend std::ostream& operator<<(std::ostream& os, BasicDirectedEdge* object) {
+            os << object->label << ": " << object->n1->getLabel() << "->"
+               << object->n2->getLabel() << "(" << object->getWeight() << ")";
+            return os;
+        }
+        friend bool operator==(const BasicDirectedEdge& first, const BasicDirectedEdge& second) {
+            return first.n1->getLabel() == second.n1->getLabel()
+            && first.n2->getLabel() == second.n2->getLabel();
+        }
+        friend bool operator!=(const BasicDirectedEdge& first, const BasicDirectedEdge& second) {
+            return !(first == second);
+        }
     };
+
+    typedef BasicBaseEdge<int> BaseEdge;
+    typedef BasicEdge<int> Edge;
+    typedef BasicDirectedEdge<int> DirectedEdge;
+
+    // The int edges are compiled once, in edge.cpp.
+    extern template class BasicBaseEdge<int>;
+    extern template class BasicEdge<int>;
+    extern template class BasicDirectedEdge<int>;
+
+    template<typename E>
+    struct is_edge : std::is_base_of<BasicEdge<typename E::WeightType>, E> {};
+
+    template<typename E>
+    struct is_directed : std::is_base_of<BasicDirectedEdge<typename E::WeightType>, E> {};
 }
 
 #endif
\ No newline at end of file
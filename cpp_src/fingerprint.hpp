@@ -0,0 +1,50 @@
+#ifndef FINGERPRINT_HPP
+#define FINGERPRINT_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "edge.hpp"
+
+using std::string;
+
+/*
+    Structural fingerprints of graphs. A graph's fingerprint is the sum, modulo 2^64,
+    of one hash per node label and one per edge, so it is kept up to date in O(1) on
+    every insert (and removal), and does not depend on insertion order. Equal graphs
+    always have equal fingerprints, so `operator==` rejects most unequal graphs without
+    looking at their contents.
+
+    Edge hashes cover the label and the endpoint labels, unordered for non-directed
+    edges, but not the weight, which graph equality ignores. Fingerprints are built on
+    std::hash and are only comparable within the same program.
+*/
+
+namespace stella {
+    // splitmix64 finalizer, so that sums of hashes do not cancel out.
+    inline uint64_t mixFingerprint(uint64_t value) {
+        value += 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    inline uint64_t labelFingerprint(const string& label) {
+        return mixFingerprint(std::hash<string>()(label));
+    }
+
+    inline uint64_t nodeFingerprint(const string& label) {
+        return mixFingerprint(labelFingerprint(label) ^ 0x6e6f6465ULL);
+    }
+
+    template<typename E>
+    uint64_t edgeFingerprint(const E& edge) {
+        uint64_t n1 = labelFingerprint(edge.getN1()->getLabel());
+        uint64_t n2 = labelFingerprint(edge.getN2()->getLabel());
+        uint64_t ends = is_directed<E>::value ? mixFingerprint(n1) ^ n2 : n1 + n2;
+        return mixFingerprint(labelFingerprint(edge.getLabel()) ^ mixFingerprint(ends));
+    }
+}
+
+#endif
\ No newline at end of file
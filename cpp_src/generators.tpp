@@ -0,0 +1,291 @@
+#ifndef GENERATORS_TPP
+#define GENERATORS_TPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "csr.tpp"
+#include "fingerprint.hpp"
+#include "graph.tpp"
+#include "parallel.tpp"
+
+using std::int64_t;
+using std::invalid_argument;
+using std::string;
+using std::uint64_t;
+using std::vector;
+
+/*
+    Synthetic graph generators, for benchmarks and tests. Each model first produces
+    EdgeArrays (node indices, weights 1), then `fillGraph` loads them into any graph
+    through the bulk interface, with nodes labeled "0" to "n-1" and edges "0" to "m-1".
+
+    Output depends on the seed only, not on the thread count: the work is cut into
+    fixed blocks, each drawing from its own SplitMix64 stream (or, for Barabási-Albert,
+    from a hash of the edge index), and the blocks are concatenated in order.
+*/
+
+namespace stella {
+    // SplitMix64 (Steele, Lea and Flood, 2014): a counter run through the splitmix64 finalizer.
+    class SplitMix64 {
+        protected:
+            uint64_t state;
+        public:
+            explicit SplitMix64(uint64_t seed) : state(seed) {}
+            // Independent stream number `stream` of `seed`.
+            static SplitMix64 stream(uint64_t seed, uint64_t stream) {
+                return SplitMix64(mixFingerprint(seed ^ mixFingerprint(stream)));
+            }
+            uint64_t next() {
+                uint64_t value = state;
+                state += 0x9e3779b97f4a7c15ULL;
+                return mixFingerprint(value);
+            }
+            // Uniform in [0, 1), from the top 53 bits.
+            double uniform() {
+                return (next() >> 11) * (1.0 / 9007199254740992.0);
+            }
+    };
+
+    // Runs `fill(block, stream, edges)` for every block and concatenates the results in block order.
+    template<typename F>
+    EdgeArrays generateBlocks(size_t blockCount, uint64_t seed, unsigned threads, F fill) {
+        vector<EdgeArrays> blocks(blockCount);
+        parallelFor(blockCount, threads, 1, [&](size_t begin, size_t end, unsigned) {
+            for (size_t block = begin; block < end; block++) {
+                SplitMix64 stream = SplitMix64::stream(seed, block);
+                fill(block, stream, blocks[block]);
+            }
+        });
+        vector<size_t> starts(blockCount + 1, 0);
+        for (size_t block = 0; block < blockCount; block++)
+            starts[block + 1] = starts[block] + blocks[block].sources.size();
+
+        EdgeArrays edges;
+        edges.sources.resize(starts[blockCount]);
+        edges.targets.resize(starts[blockCount]);
+        edges.weights.assign(starts[blockCount], 1);
+        parallelFor(blockCount, threads, 1, [&](size_t begin, size_t end, unsigned) {
+            for (size_t block = begin; block < end; block++) {
+                EdgeArrays& part = blocks[block];
+                std::copy(part.sources.begin(), part.sources.end(), edges.sources.begin() + starts[block]);
+                std::copy(part.targets.begin(), part.targets.end(), edges.targets.begin() + starts[block]);
+                vector<int64_t>().swap(part.sources);
+                vector<int64_t>().swap(part.targets);
+            }
+        });
+        return edges;
+    }
+
+    /*
+        Erdős-Rényi G(n, p): every pair of distinct nodes is linked with probability `p`,
+        ordered pairs when `directed`. Pairs are numbered and the gaps between chosen
+        pairs drawn from the geometric distribution (Batagelj and Brandes, 2005), so the
+        cost follows the edge count, not n². Blocks cover equal ranges of pairs.
+    */
+    inline EdgeArrays erdosRenyiEdges(int64_t n, double p, bool directed, uint64_t seed, unsigned threads = 1) {
+        if (n < 0) throw invalid_argument("Node count must be 0 or more");
+        if (!(p >= 0 && p <= 1)) throw invalid_argument("Edge probability must be between 0 and 1");
+        // Row u holds the pairs (u, v): v < u when non-directed, v != u when directed.
+        int64_t pairs = directed ? n * (n - 1) : n * (n - 1) / 2;
+        if (pairs <= 0 || p == 0) return EdgeArrays();
+        double expected = pairs * p;
+        size_t blockCount = std::max<double>(1, std::min<double>(expected / 65536, pairs / 65536.0));
+        int64_t blockSize = (pairs + blockCount - 1) / blockCount;
+        double logSkip = std::log1p(-p);
+
+        return generateBlocks(blockCount, seed, threads, [&](size_t block, SplitMix64& stream, EdgeArrays& edges) {
+            int64_t first = block * blockSize;
+            int64_t last = std::min(pairs, first + blockSize);
+            edges.sources.reserve(size_t(std::min<double>(last - first, (last - first) * p * 1.1 + 16)));
+            edges.targets.reserve(edges.sources.capacity());
+            // Position of pair `first - 1` as (row, offset in row).
+            int64_t row, offset;
+            if (directed) {
+                row = first / (n - 1);
+                offset = first % (n - 1);
+            } else {
+                row = (1 + std::sqrt(1 + 8.0 * first)) / 2;
+                while (row * (row - 1) / 2 > first) row--;
+                while (row * (row + 1) / 2 <= first) row++;
+                offset = first - row * (row - 1) / 2;
+            }
+            offset--;
+            for (int64_t pair = first - 1;;) {
+                double gap = p == 1 ? 0 : std::floor(std::log(1 - stream.uniform()) / logSkip);
+                if (gap >= last - pair - 1) break;
+                int64_t skip = gap;
+                pair += skip + 1;
+                offset += skip + 1;
+                for (int64_t length; offset >= (length = directed ? n - 1 : row); row++) offset -= length;
+                edges.sources.push_back(row);
+                edges.targets.push_back(directed && offset >= row ? offset + 1 : offset);
+            }
+        });
+    }
+
+    /*
+        R-MAT (Chakrabarti, Zhan and Faloutsos, 2004), the recursive Kronecker model of
+        Graph500: 2^scale nodes and `edgeCount` edges, each placed by picking one of the
+        four quadrants of the adjacency matrix with probabilities a, b, c and 1-a-b-c,
+        once per bit. Gives skewed degrees and communities; self-loops and parallel
+        edges are kept.
+    */
+    inline EdgeArrays rmatEdges(int scale, int64_t edgeCount, uint64_t seed, unsigned threads = 1,
+        double a = 0.57, double b = 0.19, double c = 0.19) {
+        if (scale < 0 || scale > 62) throw invalid_argument("R-MAT scale must be between 0 and 62");
+        if (edgeCount < 0) throw invalid_argument("Edge count must be 0 or more");
+        if (a < 0 || b < 0 || c < 0 || a + b + c > 1)
+            throw invalid_argument("R-MAT probabilities must be 0 or more and sum to at most 1");
+        const int64_t blockSize = 65536;
+        size_t blockCount = (edgeCount + blockSize - 1) / blockSize;
+        // Quadrant bounds; the comparisons give the two bits without branches.
+        const double ab = a + b, abc = a + b + c;
+        return generateBlocks(blockCount, seed, threads, [=](size_t block, SplitMix64& stream, EdgeArrays& edges) {
+            int64_t count = std::min(blockSize, edgeCount - int64_t(block) * blockSize);
+            edges.sources.resize(count);
+            edges.targets.resize(count);
+            for (int64_t e = 0; e < count; e++) {
+                int64_t source = 0, target = 0;
+                for (int bit = 0; bit < scale; bit++) {
+                    double r = stream.uniform();
+                    source = source << 1 | (r >= ab);
+                    target = target << 1 | ((r >= a) ^ (r >= ab) ^ (r >= abc));
+                }
+                edges.sources[e] = source;
+                edges.targets[e] = target;
+            }
+        });
+    }
+
+    /*
+        Barabási-Albert preferential attachment: node v >= 1 links to `m` earlier nodes,
+        chosen with probability proportional to their degree, for (n - 1) * m edges
+        (node 1 links to node 0 m times). As in Batagelj and Brandes, edge i picks an
+        endpoint of a uniformly drawn earlier edge; here the draw is a hash of the seed
+        and i (Sanders and Schulz, 2016), so every edge is resolved independently and in
+        parallel by following the draws back to an edge source. Only edges of earlier
+        nodes are drawn, so there are no self-loops; parallel edges may occur.
+    */
+    inline EdgeArrays barabasiAlbertEdges(int64_t n, int64_t m, uint64_t seed, unsigned threads = 1) {
+        if (n < 0) throw invalid_argument("Node count must be 0 or more");
+        if (m < 1) throw invalid_argument("Edges per node must be 1 or more");
+        int64_t edgeCount = n > 1 ? (n - 1) * m : 0;
+        uint64_t key = mixFingerprint(seed);
+        // Endpoint `position` of the edge list: 2i is the source of edge i, 2i + 1 its target.
+        auto resolve = [&](int64_t position) {
+            while (position & 1) {
+                int64_t edge = position / 2;
+                int64_t source = edge / m + 1;
+                if (source == 1) return int64_t(0);
+                position = mixFingerprint(key ^ uint64_t(edge)) % uint64_t(2 * (source - 1) * m);
+            }
+            return position / 2 / m + 1;
+        };
+        EdgeArrays edges;
+        edges.sources.resize(edgeCount);
+        edges.targets.resize(edgeCount);
+        edges.weights.assign(edgeCount, 1);
+        parallelFor(edgeCount, threads, 65536, [&](size_t begin, size_t end, unsigned) {
+            for (size_t edge = begin; edge < end; edge++) {
+                edges.sources[edge] = edge / m + 1;
+                edges.targets[edge] = resolve(2 * edge + 1);
+            }
+        });
+        return edges;
+    }
+
+    /*
+        rows x cols grid, node r * cols + c linked to its right and lower neighbors.
+        Each link is dropped with probability `drop`, which with a small value gives
+        planar, low degree, large diameter graphs like road networks.
+    */
+    inline EdgeArrays gridEdges(int64_t rows, int64_t cols, double drop, uint64_t seed, unsigned threads = 1) {
+        if (rows < 0 || cols < 0) throw invalid_argument("Grid size must be 0 or more");
+        if (!(drop >= 0 && drop <= 1)) throw invalid_argument("Drop probability must be between 0 and 1");
+        return generateBlocks(rows, seed, threads, [&](size_t block, SplitMix64& stream, EdgeArrays& edges) {
+            int64_t row = block;
+            edges.sources.reserve(2 * cols);
+            edges.targets.reserve(2 * cols);
+            for (int64_t col = 0; col < cols; col++) {
+                int64_t node = row * cols + col;
+                if (col + 1 < cols && !(drop > 0 && stream.uniform() < drop)) {
+                    edges.sources.push_back(node);
+                    edges.targets.push_back(node + 1);
+                }
+                if (row + 1 < rows && !(drop > 0 && stream.uniform() < drop)) {
+                    edges.sources.push_back(node);
+                    edges.targets.push_back(node + cols);
+                }
+            }
+        });
+    }
+
+    // Generated labels always start at "0", so the graph must not have any node yet.
+    // The generate functions check it first, before any edge is generated.
+    template<typename G>
+    void requireEmpty(G& graph) {
+        if (!graph.getAllNodes().empty())
+            throw invalid_argument("Graph must be empty to generate into it");
+    }
+
+    /*
+        Adds nodes "0" to "nodeCount - 1" and the edges of `edges`, labeled by their
+        position, to the empty `graph` in one bulk insert each. Labels are built in
+        parallel; the inserts themselves run on the calling thread.
+    */
+    template<typename G>
+    void fillGraph(G& graph, int64_t nodeCount, const EdgeArrays& edges, unsigned threads = 1) {
+        typedef typename G::Weight Weight;
+        requireEmpty(graph);
+        vector<string> labels(nodeCount);
+        parallelFor(nodeCount, threads, 65536, [&](size_t begin, size_t end, unsigned) {
+            for (size_t node = begin; node < end; node++) labels[node] = std::to_string(node);
+        });
+        vector<BasicEdgeEntry<Weight>> entries(edges.sources.size());
+        parallelFor(entries.size(), threads, 65536, [&](size_t begin, size_t end, unsigned) {
+            for (size_t e = begin; e < end; e++) {
+                entries[e].label = std::to_string(e);
+                entries[e].n1 = labels[edges.sources[e]];
+                entries[e].n2 = labels[edges.targets[e]];
+                entries[e].weight = Weight(edges.weights[e]);
+            }
+        });
+        graph.reserve(nodeCount, entries.size());
+        graph.addNodes(labels);
+        graph.addEdges(entries);
+    }
+
+    template<typename G>
+    void generateErdosRenyi(G& graph, int64_t n, double p, uint64_t seed, unsigned threads = 1) {
+        requireEmpty(graph);
+        fillGraph(graph, n, erdosRenyiEdges(n, p, is_directed<typename G::EdgeType>::value, seed, threads), threads);
+    }
+
+    template<typename G>
+    void generateRMAT(G& graph, int scale, int64_t edgeCount, uint64_t seed, unsigned threads = 1,
+        double a = 0.57, double b = 0.19, double c = 0.19) {
+        requireEmpty(graph);
+        // rmatEdges validates `scale`, so it runs before the shift.
+        EdgeArrays edges = rmatEdges(scale, edgeCount, seed, threads, a, b, c);
+        fillGraph(graph, int64_t(1) << scale, edges, threads);
+    }
+
+    template<typename G>
+    void generateBarabasiAlbert(G& graph, int64_t n, int64_t m, uint64_t seed, unsigned threads = 1) {
+        requireEmpty(graph);
+        fillGraph(graph, n, barabasiAlbertEdges(n, m, seed, threads), threads);
+    }
+
+    template<typename G>
+    void generateGrid(G& graph, int64_t rows, int64_t cols, double drop, uint64_t seed, unsigned threads = 1) {
+        requireEmpty(graph);
+        fillGraph(graph, rows * cols, gridEdges(rows, cols, drop, seed, threads), threads);
+    }
+}
+
+#endif
\ No newline at end of file
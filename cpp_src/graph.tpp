@@ -1,31 +1,196 @@
 #ifndef GRAPH_HPP
 #define GRAPH_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <string>
 #include <vector>
 #include <type_traits>
 
+#include "fingerprint.hpp"
+#include "memory.hpp"
 #include "node.hpp"
+#include "stats.hpp"
+#include "union_find.hpp"
 
+using std::int64_t;
+using std::invalid_argument;
 using std::is_base_of;
 using std::shared_ptr;
 using std::string;
 using std::vector;
 
 namespace stella {
+    /*
+        Plain record used by the bulk insertion path (`Graph::addEdges`),
+        so that parsers and bindings can gather a whole edge table into
+        a contiguous buffer before touching the graph.
+    */
+    template<typename W>
+    struct BasicEdgeEntry {
+        string label;
+        string n1;
+        string n2;
+        W weight;
+    };
+
+    typedef BasicEdgeEntry<int> EdgeEntry;
+
+    /*
+        Graph epochs come from one process-wide counter, so no two graph states ever
+        share an epoch: not two graphs, and not a graph before and after it is assigned
+        from another one. A copy takes a fresh epoch rather than that of its source.
+    */
+    inline uint64_t nextEpoch() {
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    struct GraphEpoch {
+        uint64_t value = nextEpoch();
+
+        GraphEpoch() {}
+        GraphEpoch(const GraphEpoch&) {}
+        GraphEpoch& operator=(const GraphEpoch&) {
+            value = nextEpoch();
+            return *this;
+        }
+        void advance() {
+            value = nextEpoch();
+        }
+    };
+
     template <typename N, typename E>
     class Graph {
         static_assert(is_base_of<Node, N>::value, "N must be of type stella::Node");
         public:
             using NodeType = N;
             using EdgeType = E;
+            // Weights as passed to addEdge; `int` for the default edges.
+            using Weight = typename E::Weight;
             virtual void addNode(shared_ptr<N> node) = 0;
             virtual void addNode(string label) = 0;
             virtual void addEdge(shared_ptr<E> edge) = 0;
             virtual void addEdge(string label, string n1, string n2) = 0;
-            virtual void addEdge(string label, string n1, string n2, int weight) = 0;
+            virtual void addEdge(string label, string n1, string n2, Weight weight) = 0;
+            // Removal throws invalid_argument when nothing matches, and returns what was removed.
+            virtual shared_ptr<N> removeNode(string label) = 0;
+            virtual shared_ptr<E> removeEdge(string label, string n1, string n2) = 0;
+            // Moves the node at index `order[i]` to index `i`, with its edges; see reorder.tpp.
+            virtual void permuteNodes(const vector<int64_t>& order) = 0;
             virtual shared_ptr<N> getNode(string label) = 0;
             virtual vector<shared_ptr<N>>& getAllNodes() = 0;
+
+            // Bulk interface. Subclasses override these with batched fast paths,
+            // the defaults only fall back to the single element methods.
+            virtual void reserve(size_t nodeCount, size_t edgeCount) {}
+            virtual void addNodes(const vector<string>& labels) {
+                for (const string& label : labels) addNode(label);
+            }
+            virtual void addEdges(const vector<BasicEdgeEntry<Weight>>& entries) {
+                for (const BasicEdgeEntry<Weight>& entry : entries)
+                    addEdge(entry.label, entry.n1, entry.n2, entry.weight);
+            }
+            // Bytes held by the graph, by category (see memory.hpp). Subclasses add their
+            // edge storage to the node vector and node objects counted here.
+            virtual MemoryUsage memoryUsage() {
+                MemoryUsage usage;
+                vector<shared_ptr<N>>& nodes = getAllNodes();
+                usage.containers += vectorSize(nodes);
+                for (const shared_ptr<N>& node : nodes) {
+                    addShared<N>(usage, usage.nodes);
+                    usage.labels += labelBytes(node->getLabel());
+                }
+                usage.containers += components.heapBytes();
+                return usage;
+            }
+            // Order independent hash of the node and edge labels, see fingerprint.hpp.
+            uint64_t getFingerprint() const {
+                return fingerprint;
+            }
+            // Changes on every successful insert or removal, copy or assignment, so a result
+            // computed at one epoch is still valid for as long as the graph reports it.
+            uint64_t getEpoch() const {
+                return epoch.value;
+            }
+            /*
+                Connected components (weakly connected for directed graphs), kept in a
+                UnionFind. The first query builds it in one pass over the edges; from then
+                on every addNode and addEdge updates it in O(α(n)), so queries stay cheap
+                under insert-only workloads. A removal drops it, to be rebuilt by the next
+                query. Graphs that are never queried only pay a null check per insert.
+            */
+            bool connected(const string& n1, const string& n2) {
+                int node1 = findNodeIndex(n1);
+                int node2 = findNodeIndex(n2);
+                if (node1 < 0 || node2 < 0)
+                    throw invalid_argument("Node labels not found: " + n1 + " " + n2);
+                UnionFind& sets = trackedComponents();
+                return sets.find(node1) == sets.find(node2);
+            }
+            // Index of the node that stands for the component; it may change when components merge.
+            int componentOf(const string& label) {
+                int index = findNodeIndex(label);
+                if (index < 0)
+                    throw invalid_argument("Node not found: " + label);
+                return trackedComponents().find(index);
+            }
+            size_t componentCount() {
+                return trackedComponents().setCount();
+            }
+            virtual ~Graph() {}
+        protected:
+            uint64_t fingerprint = 0;
+            GraphEpoch epoch;
+            UnionFind components;
+            bool tracking = false;
+
+            virtual int findNodeIndex(const string& label) = 0;
+            // Unites the ends of every edge, for the first build of `components`.
+            virtual void uniteEdges(UnionFind& sets) = 0;
+            UnionFind& trackedComponents() {
+                if (!tracking) {
+                    components = UnionFind(getAllNodes().size());
+                    uniteEdges(components);
+                    tracking = true;
+                }
+                return components;
+            }
+            void trackNodes(size_t nodeCount) {
+                if (tracking) components.resize(nodeCount);
+            }
+            void trackEdge(int n1, int n2) {
+                if (tracking) components.unite(n1, n2);
+            }
+            void checkPermutation(const vector<int64_t>& order) {
+                size_t size = getAllNodes().size();
+                if (order.size() != size)
+                    throw invalid_argument("Node order has " + std::to_string(order.size())
+                        + " entries for " + std::to_string(size) + " nodes");
+                vector<char> seen(size, 0);
+                for (int64_t index : order) {
+                    if (index < 0 || index >= (int64_t) size || seen[index])
+                        throw invalid_argument("Node order is not a permutation");
+                    seen[index] = 1;
+                }
+            }
+            void dropComponents() {
+                if (!tracking) return;
+                components = UnionFind();
+                tracking = false;
+            }
+#ifdef STELLA_STATS
+            GraphStats stats;
+        public:
+            const GraphStats& getStats() const {
+                return stats;
+            }
+            void resetStats() {
+                stats = GraphStats();
+            }
+#endif
     };
 }
 
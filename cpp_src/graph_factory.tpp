@@ -0,0 +1,80 @@
+#ifndef GRAPH_FACTORY_TPP
+#define GRAPH_FACTORY_TPP
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "adj_list.tpp"
+#include "adj_matrix.tpp"
+
+using std::map;
+using std::shared_ptr;
+using std::size_t;
+using std::string;
+using std::unique_ptr;
+
+namespace stella {
+    /*
+        Picks between AdjList and AdjMatrix for a graph of known size. A matrix answers
+        "edges between a and b" with one cell but scans V cells for the edges of a node,
+        and costs a cell map for each of the V^2 pairs; an adjacency list scans the
+        incident edges, about 2E/V, for both. So small dense graphs that are mostly
+        probed by pair go to a matrix, the rest to adjacency lists. Graphs can be moved
+        across later with the conversion constructors of both classes.
+    */
+    enum GraphRepresentation { REPRESENTATION_LIST, REPRESENTATION_MATRIX };
+
+    // Relative weight of each kind of query, in any unit: pair lookups (`getEdge`,
+    // `getEdges`) against neighbor scans (traversals, algorithms, incident edges).
+    struct QueryMix {
+        double pairLookups = 1;
+        double neighborScans = 1;
+    };
+
+    const size_t DEFAULT_MATRIX_BYTES = size_t(256) << 20;
+
+    inline GraphRepresentation chooseRepresentation(size_t nodeCount, size_t edgeCount,
+            bool directed, QueryMix mix = QueryMix(), size_t matrixBytes = DEFAULT_MATRIX_BYTES) {
+        double cells = double(nodeCount) * nodeCount;
+        if (nodeCount == 0 || cells * sizeof(map<string, shared_ptr<Node>>) > matrixBytes)
+            return REPRESENTATION_LIST;
+        // Directed edges are listed at both ends too, and a directed matrix scans a row
+        // and a column to find the edges of a node.
+        double degree = 2.0 * edgeCount / nodeCount;
+        double row = directed ? 2.0 * nodeCount : nodeCount;
+        double listCost = (mix.pairLookups + mix.neighborScans) * degree;
+        double matrixCost = mix.pairLookups + mix.neighborScans * row;
+        return matrixCost < listCost ? REPRESENTATION_MATRIX : REPRESENTATION_LIST;
+    }
+
+    template<typename N, typename E>
+    unique_ptr<Graph<N, E>> newGraph(GraphRepresentation representation, std::false_type) {
+        if (representation == REPRESENTATION_MATRIX) return unique_ptr<Graph<N, E>>(new AdjMatrix<N, E>());
+        return unique_ptr<Graph<N, E>>(new AdjList<N, E>());
+    }
+
+    template<typename N, typename E>
+    unique_ptr<Graph<N, E>> newGraph(GraphRepresentation representation, std::true_type) {
+        if (representation == REPRESENTATION_MATRIX) return unique_ptr<Graph<N, E>>(new DirectedAdjMatrix<N, E>());
+        return unique_ptr<Graph<N, E>>(new DirectedAdjList<N, E>());
+    }
+
+    /*
+        An empty graph in the representation chosen for `nodeCount` nodes and `edgeCount`
+        edges, already reserved for them. Directed edge types get the directed classes.
+    */
+    template<typename N, typename E>
+    unique_ptr<Graph<N, E>> makeGraph(size_t nodeCount, size_t edgeCount, QueryMix mix = QueryMix(),
+            size_t matrixBytes = DEFAULT_MATRIX_BYTES) {
+        GraphRepresentation representation =
+            chooseRepresentation(nodeCount, edgeCount, is_directed<E>::value, mix, matrixBytes);
+        unique_ptr<Graph<N, E>> graph = newGraph<N, E>(representation, is_directed<E>());
+        graph->reserve(nodeCount, edgeCount);
+        return graph;
+    }
+}
+
+#endif
\ No newline at end of file
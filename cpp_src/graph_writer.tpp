@@ -0,0 +1,242 @@
+#ifndef GRAPH_WRITER_TPP
+#define GRAPH_WRITER_TPP
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+    Like the Lua parser, this header is kept separate from the main `stella.hpp`
+    header file, since it needs C++17 (`std::to_chars`). Compile with `-std=c++17`.
+
+    All writers stream through one output buffer that is owned by the `GraphWriter`
+    and reused between calls, and format integers with `std::to_chars`, so
+    dumping very large graphs is bound by I/O instead of iostream formatting.
+    Floating point weights are written in their shortest round-trip form. Infinite
+    and NaN weights are written as `1/0`, `-1/0` and `0/0` by `writeLua`, as `inf`
+    and `nan` by `writeEdgeList`, and make `writeDot` throw, since DOT has no
+    spelling for them.
+
+    Supported formats:
+    * `writeLua`: the `nodes`/`edges` tables read by `stella::LuaParser`;
+    * `writeEdgeList`: one `n1 n2 weight` line per edge;
+    * `writeDot`: Graphviz DOT (`graph` or `digraph`, following the edge type).
+*/
+#include "stella.hpp"
+
+using std::ostream;
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+namespace stella {
+    class GraphWriter {
+        private:
+            vector<char> buffer;
+            size_t used;
+            FILE* file;
+            ostream* stream;
+
+            void flush() {
+                if (used == 0) return;
+                if (file != nullptr) {
+                    if (fwrite(buffer.data(), 1, used, file) != used)
+                        throw runtime_error("GraphWriter failed to write output");
+                } else if (stream != nullptr) {
+                    stream->write(buffer.data(), used);
+                    if (!*stream) throw runtime_error("GraphWriter failed to write output");
+                }
+                used = 0;
+            }
+            void put(char c) {
+                if (used == buffer.size()) flush();
+                buffer[used++] = c;
+            }
+            void put(const char* data, size_t size) {
+                while (size > 0) {
+                    if (used == buffer.size()) flush();
+                    size_t chunk = std::min(size, buffer.size() - used);
+                    std::copy(data, data + chunk, buffer.data() + used);
+                    used += chunk;
+                    data += chunk;
+                    size -= chunk;
+                }
+            }
+            void put(const string& text) {
+                put(text.data(), text.size());
+            }
+            template<size_t Size>
+            void put(const char (&literal)[Size]) {
+                put(literal, Size - 1);
+            }
+            void putInt(long long value) {
+                if (buffer.size() - used < 24) flush();
+                std::to_chars_result result = std::to_chars(
+                    buffer.data() + used, buffer.data() + buffer.size(), value);
+                used = result.ptr - buffer.data();
+            }
+            // Shortest form that reads back to the same value.
+            void putFloat(double value) {
+                if (buffer.size() - used < 32) flush();
+                std::to_chars_result result = std::to_chars(
+                    buffer.data() + used, buffer.data() + buffer.size(), value);
+                used = result.ptr - buffer.data();
+            }
+            template<typename W>
+            void putWeight(W weight) {
+                if (std::is_floating_point<W>::value) putFloat(weight);
+                else putInt(weight);
+            }
+            // Lua has no literal for infinity or NaN, so these are written as divisions.
+            template<typename W>
+            void putLuaWeight(W weight) {
+                if (!std::is_floating_point<W>::value || std::isfinite((double) weight)) putWeight(weight);
+                else if (std::isnan((double) weight)) put("0/0");
+                else put(weight > 0 ? "1/0" : "-1/0");
+            }
+            template<typename E>
+            void putDotWeight(const E& edge) {
+                if (std::is_floating_point<typename E::Weight>::value && !std::isfinite((double) edge.getWeight()))
+                    throw runtime_error("GraphWriter cannot write non-finite weight of " + edge.getLabel() + " to DOT");
+                putWeight(edge.getWeight());
+            }
+            // Double quoted string literal, valid both in Lua and in DOT.
+            void putQuoted(const string& text) {
+                put('"');
+                for (char c : text) {
+                    switch (c) {
+                        case '"': put("\\\""); break;
+                        case '\\': put("\\\\"); break;
+                        case '\n': put("\\n"); break;
+                        case '\r': put("\\r"); break;
+                        case '\t': put("\\t"); break;
+                        default: put(c);
+                    }
+                }
+                put('"');
+            }
+
+            template<typename G>
+            void lua(G& graph) {
+                put("nodes = {\n");
+                for (auto& node : graph.getAllNodes()) {
+                    put("    ");
+                    putQuoted(node->getLabel());
+                    put(",\n");
+                }
+                put("}\n\nedges = {\n");
+                graph.forEachEdge([this](const shared_ptr<typename G::EdgeType>& edge) {
+                    put("    [");
+                    putQuoted(edge->getLabel());
+                    put("] = {n1 = ");
+                    putQuoted(edge->getN1()->getLabel());
+                    put(", n2 = ");
+                    putQuoted(edge->getN2()->getLabel());
+                    put(", weight = ");
+                    putLuaWeight(edge->getWeight());
+                    put("},\n");
+                });
+                put("}\n");
+            }
+            template<typename G>
+            void edgeList(G& graph) {
+                graph.forEachEdge([this](const shared_ptr<typename G::EdgeType>& edge) {
+                    put(edge->getN1()->getLabel());
+                    put(' ');
+                    put(edge->getN2()->getLabel());
+                    put(' ');
+                    putWeight(edge->getWeight());
+                    put('\n');
+                });
+            }
+            template<typename G>
+            void dot(G& graph) {
+                bool directed = is_directed<typename G::EdgeType>::value;
+                put(directed ? "digraph {\n" : "graph {\n");
+                for (auto& node : graph.getAllNodes()) {
+                    put("    ");
+                    putQuoted(node->getLabel());
+                    put(";\n");
+                }
+                graph.forEachEdge([this, directed](const shared_ptr<typename G::EdgeType>& edge) {
+                    put("    ");
+                    putQuoted(edge->getN1()->getLabel());
+                    put(directed ? " -> " : " -- ");
+                    putQuoted(edge->getN2()->getLabel());
+                    put(" [label=");
+                    putQuoted(edge->getLabel());
+                    put(", weight=");
+                    putDotWeight(*edge);
+                    put("];\n");
+                });
+                put("}\n");
+            }
+
+            template<typename F>
+            void toFile(const string& filename, F write) {
+                file = fopen(filename.c_str(), "wb");
+                if (file == nullptr) throw runtime_error("GraphWriter cannot open " + filename);
+                try {
+                    write();
+                    flush();
+                } catch (...) {
+                    fclose(file);
+                    file = nullptr;
+                    used = 0;
+                    throw;
+                }
+                int status = fclose(file);
+                file = nullptr;
+                if (status != 0) throw runtime_error("GraphWriter failed to write " + filename);
+            }
+            template<typename F>
+            void toStream(ostream& os, F write) {
+                stream = &os;
+                try {
+                    write();
+                    flush();
+                } catch (...) {
+                    stream = nullptr;
+                    used = 0;
+                    throw;
+                }
+                stream = nullptr;
+            }
+        public:
+            GraphWriter(size_t bufferSize = 1 << 20)
+                : buffer(bufferSize < 64 ? 64 : bufferSize), used(0), file(nullptr), stream(nullptr) {}
+
+            template<typename G>
+            void writeLua(G& graph, const string& filename) {
+                toFile(filename, [&]() { lua(graph); });
+            }
+            template<typename G>
+            void writeLua(G& graph, ostream& os) {
+                toStream(os, [&]() { lua(graph); });
+            }
+            template<typename G>
+            void writeEdgeList(G& graph, const string& filename) {
+                toFile(filename, [&]() { edgeList(graph); });
+            }
+            template<typename G>
+            void writeEdgeList(G& graph, ostream& os) {
+                toStream(os, [&]() { edgeList(graph); });
+            }
+            template<typename G>
+            void writeDot(G& graph, const string& filename) {
+                toFile(filename, [&]() { dot(graph); });
+            }
+            template<typename G>
+            void writeDot(G& graph, ostream& os) {
+                toStream(os, [&]() { dot(graph); });
+            }
+    };
+}
+
+#endif
\ No newline at end of file
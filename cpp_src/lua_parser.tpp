@@ -1,9 +1,16 @@
 #ifndef LUA_PARSER_HPP
 #define LUA_PARSER_HPP
 
+#include <ctime>
 #include <exception>
+#include <limits>
+#include <map>
 #include <memory>
+#include <string>
 #include <type_traits>
+#include <vector>
+
+#include <sys/stat.h>
 
 /*
     To ensure compatibility, this header will be kept separate
@@ -21,7 +28,7 @@
     For example, let's say your Lua source (and shared object) are at `~/Documents/lua`.
     At compilation, use:
 
-    `g++ main.cpp cpp_src/*.cpp -L~/Documents/lua-5.4.7/src -llua -o main.out`,
+    `g++ main.cpp cpp_src/node.cpp cpp_src/edge.cpp -L~/Documents/lua-5.4.7/src -llua -o main.out`,
 
     with `-L~/Documents/lua-5.4.7./src` being the directory for your shared object
     and `-llua` the flag with the library name.
@@ -32,67 +39,233 @@
 #include "stella.hpp"
 
 using std::is_base_of;
+using std::map;
 using std::unique_ptr;
 using std::make_unique;
 using std::runtime_error;
+using std::vector;
 
 namespace stella {
+    /*
+        A single `lua_State` is kept for the whole lifetime of the parser and reused
+        by every `load` call. Files are compiled once to Lua bytecode and cached
+        (keyed by filename, modification time and size), so configuration graphs that are
+        reloaded often skip the Lua compiler entirely.
+
+        The `nodes` and `edges` tables are first gathered into contiguous buffers
+        and then handed to the graph through its bulk insertion methods
+        (`reserve`, `addNodes` and `addEdges`).
+
+        Edges without a `weight` field get a weight of 1; any other weight, 0
+        included, is kept as written. Weights are read as integers or as floating
+        point numbers following the weight type of the graph.
+    */
     class LuaParser {
         private:
+            // A file is recompiled when any of these change. The modification time has
+            // nanosecond resolution, so a rewrite within the same second is still seen.
+            struct Chunk {
+                dev_t device;
+                ino_t inode;
+                timespec modified;
+                off_t size;
+                string bytecode;
+            };
             lua_State* L;
-        public:
-            LuaParser() {
-                L = luaL_newstate();
-                if (L == nullptr) throw runtime_error("LuaParser failed to initialize");
+            map<string, Chunk> chunks;
+            vector<string> nodeBuffer;
+            vector<EdgeEntry> edgeBuffer;
+
+            static int writeChunk(lua_State* L, const void* data, size_t size, void* out) {
+                static_cast<string*>(out)->append(static_cast<const char*>(data), size);
+                return 0;
             }
-            template<typename G>
-            void load(const string& filename, G* graph) {
-                static_assert(is_base_of<Graph<typename G::NodeType, typename G::EdgeType>, G>::value, "G must be derived from stella::Graph");
-                if (luaL_dofile(L, filename.c_str()) != LUA_OK) {
-                    throw runtime_error(lua_tostring(L, -1));
+            static timespec modifiedTime(const struct stat& info) {
+#ifdef __APPLE__
+                return info.st_mtimespec;
+#else
+                return info.st_mtim;
+#endif
+            }
+            static bool unchanged(const Chunk& chunk, const struct stat& info) {
+                timespec modified = modifiedTime(info);
+                return chunk.device == info.st_dev && chunk.inode == info.st_ino
+                    && chunk.modified.tv_sec == modified.tv_sec && chunk.modified.tv_nsec == modified.tv_nsec
+                    && chunk.size == info.st_size;
+            }
+            // Drops the tables so that the next file loaded by this state cannot see them.
+            void dropTables() {
+                lua_pushnil(L);
+                lua_setglobal(L, "nodes");
+                lua_pushnil(L);
+                lua_setglobal(L, "edges");
+            }
+            void raise() {
+                string message = lua_tostring(L, -1) ? lua_tostring(L, -1) : "LuaParser unknown error";
+                lua_settop(L, 0);
+                dropTables();
+                throw runtime_error(message);
+            }
+            void run() {
+                if (lua_pcall(L, 0, 0, 0) != LUA_OK) raise();
+            }
+            const Chunk& compile(const string& filename) {
+                struct stat info;
+                if (stat(filename.c_str(), &info) != 0)
+                    throw runtime_error("cannot open " + filename);
+                auto it = chunks.find(filename);
+                if (it != chunks.end() && unchanged(it->second, info))
+                    return it->second;
+
+                if (luaL_loadfilex(L, filename.c_str(), nullptr) != LUA_OK) raise();
+                Chunk chunk{info.st_dev, info.st_ino, modifiedTime(info), info.st_size, string()};
+                lua_dump(L, writeChunk, &chunk.bytecode, 0);
+                lua_pop(L, 1);
+                return chunks[filename] = std::move(chunk);
+            }
+            // Reads a string at `index` without converting numeric keys in place,
+            // which would break a running `lua_next` traversal.
+            bool readString(int index, string& out) {
+                if (lua_type(L, index) == LUA_TSTRING) {
+                    size_t length;
+                    const char* value = lua_tolstring(L, index, &length);
+                    out.assign(value, length);
+                    return true;
                 }
+                if (lua_type(L, index) != LUA_TNUMBER) return false;
+                lua_pushvalue(L, index);
+                size_t length;
+                const char* value = lua_tolstring(L, -1, &length);
+                out.assign(value, length);
+                lua_pop(L, 1);
+                return true;
+            }
+            // Integer weights must be integral Lua numbers that fit in W.
+            template<typename W>
+            bool readWeight(int index, W& out) {
+                if (lua_isnil(L, index)) {
+                    out = 1;
+                    return true;
+                }
+                int isNumber;
+                if (std::is_floating_point<W>::value) {
+                    out = (W) lua_tonumberx(L, index, &isNumber);
+                    return isNumber;
+                }
+                lua_Integer value = lua_tointegerx(L, index, &isNumber);
+                if (isNumber && (value < std::numeric_limits<W>::min() || value > std::numeric_limits<W>::max())) {
+                    lua_settop(L, 0);
+                    throw runtime_error("Lua parse error, weight out of range");
+                }
+                out = (W) value;
+                return isNumber;
+            }
+            // The buffer is kept between loads for the default int weights.
+            vector<EdgeEntry>& edgeStorage(int*) {
+                return edgeBuffer;
+            }
+            template<typename W>
+            vector<BasicEdgeEntry<W>> edgeStorage(W*) {
+                return vector<BasicEdgeEntry<W>>();
+            }
+            template<typename W>
+            void gather(vector<BasicEdgeEntry<W>>& edges) {
+                nodeBuffer.clear();
+                edges.clear();
+
                 lua_getglobal(L, "nodes");
-                if (lua_istable(L, -1)) {
-                    lua_pushnil(L);
-                    while (lua_next(L, -2) != 0) {
-                        std::string nodeLabel = lua_tostring(L, -1);
-                        graph->addNode(nodeLabel);
-                        lua_pop(L, 1);
+                if (!lua_istable(L, -1)) {
+                    lua_settop(L, 0);
+                    throw runtime_error("LuaParser syntax error: missing nodes table");
+                }
+                nodeBuffer.reserve(lua_rawlen(L, -1));
+                lua_pushnil(L);
+                while (lua_next(L, -2) != 0) {
+                    nodeBuffer.emplace_back();
+                    if (!readString(-1, nodeBuffer.back())) {
+                        lua_settop(L, 0);
+                        throw runtime_error("Lua parse syntax error, node label must be a string");
                     }
+                    lua_pop(L, 1);
                 }
-                else throw std::runtime_error("LuaParser syntax error: missing nodes table");
                 lua_pop(L, 1);
 
                 lua_getglobal(L, "edges");
-                if (lua_istable(L, -1)) {
-                    lua_pushnil(L);
-                    while (lua_next(L, -2) != 0) {
-                        const char* edgeLabel = lua_tostring(L, -2);
-                        if (edgeLabel == nullptr) throw runtime_error("Lua parse syntax error, missing edge label");
-
-                        lua_pushstring(L, "n1");
-                        lua_gettable(L, -2);
-                        const char* n1 = lua_tostring(L, -1);
-                        if (n1 == nullptr) throw runtime_error("Lua parse syntax error, missing n1 label");
-                        lua_pop(L, 1);
-
-                        lua_pushstring(L, "n2");
-                        lua_gettable(L, -2);
-                        const char* n2 = lua_tostring(L, -1);
-                        if (n2 == nullptr) throw runtime_error("Lua parse syntax error, missing n1 label");
-                        lua_pop(L, 1);
-
-                        lua_pushstring(L, "weight");
-                        lua_gettable(L, -2);
-                        int weight = lua_tointeger(L, -1);
-                        if (weight == 0) weight++;
-                        lua_pop(L, 1);
-
-                        graph->addEdge(edgeLabel, n1, n2, weight);
-                        lua_pop(L, 1);
+                if (!lua_istable(L, -1)) {
+                    lua_settop(L, 0);
+                    throw runtime_error("LuaParser syntax error: missing edges table");
+                }
+                lua_pushnil(L);
+                while (lua_next(L, -2) != 0) {
+                    edges.emplace_back();
+                    BasicEdgeEntry<W>& entry = edges.back();
+                    if (!readString(-2, entry.label) || !lua_istable(L, -1)) {
+                        lua_settop(L, 0);
+                        throw runtime_error("Lua parse syntax error, missing edge label");
+                    }
+
+                    lua_getfield(L, -1, "n1");
+                    bool hasN1 = readString(-1, entry.n1);
+                    lua_getfield(L, -2, "n2");
+                    bool hasN2 = readString(-1, entry.n2);
+                    lua_getfield(L, -3, "weight");
+                    bool hasWeight = readWeight(-1, entry.weight);
+                    lua_pop(L, 3);
+
+                    if (!hasN1) {
+                        lua_settop(L, 0);
+                        throw runtime_error("Lua parse syntax error, missing n1 label");
                     }
-                } else throw std::runtime_error("LuaParser syntax error: missing edges table");
+                    if (!hasN2) {
+                        lua_settop(L, 0);
+                        throw runtime_error("Lua parse syntax error, missing n2 label");
+                    }
+                    if (!hasWeight) {
+                        lua_settop(L, 0);
+                        throw runtime_error("Lua parse syntax error, weight of " + entry.label + " must be a number");
+                    }
+                    lua_pop(L, 1);
+                }
                 lua_pop(L, 1);
+                dropTables();
+            }
+            template<typename G>
+            void fill(G* graph) {
+                static_assert(is_base_of<Graph<typename G::NodeType, typename G::EdgeType>, G>::value, "G must be derived from stella::Graph");
+                auto&& edges = edgeStorage((typename G::Weight*) nullptr);
+                try {
+                    gather(edges);
+                } catch (...) {
+                    dropTables();
+                    throw;
+                }
+                graph->reserve(graph->getAllNodes().size() + nodeBuffer.size(), edges.size());
+                graph->addNodes(nodeBuffer);
+                graph->addEdges(edges);
+            }
+        public:
+            LuaParser() {
+                L = luaL_newstate();
+                if (L == nullptr) throw runtime_error("LuaParser failed to initialize");
+            }
+            template<typename G>
+            void load(const string& filename, G* graph) {
+                lua_settop(L, 0);
+                const Chunk& chunk = compile(filename);
+                if (luaL_loadbufferx(L, chunk.bytecode.data(), chunk.bytecode.size(),
+                        filename.c_str(), "b") != LUA_OK) raise();
+                run();
+                fill(graph);
+            }
+            template<typename G>
+            void loadString(const string& source, G* graph) {
+                lua_settop(L, 0);
+                if (luaL_loadbufferx(L, source.data(), source.size(), "=string", "t") != LUA_OK) raise();
+                run();
+                fill(graph);
+            }
+            void clearCache() {
+                chunks.clear();
             }
             ~LuaParser() {
                 lua_close(L);
@@ -0,0 +1,370 @@
+#ifndef MAPPED_CSR_TPP
+#define MAPPED_CSR_TPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "csr.tpp"
+#include "union_find.hpp"
+
+using std::int64_t;
+using std::invalid_argument;
+using std::runtime_error;
+using std::string;
+using std::uint32_t;
+using std::uint64_t;
+using std::vector;
+
+/*
+    Out-of-core CSR adjacency, kept in a file and memory-mapped. POSIX only, so
+    it is not part of stella.hpp: include mapped_csr.tpp directly.
+
+    File layout, native byte order: a 64-byte header, then the targets, the weights
+    and the offsets, each an array of 8-byte values. MappedCSRWriter streams rows
+    to the file without holding the edges in memory; BasicMappedCSR maps it back.
+*/
+
+namespace stella {
+    struct MappedCSRHeader {
+        char magic[8];
+        uint32_t version;
+        // 0 for int64_t weights, 1 for double.
+        uint32_t weightKind;
+        uint64_t nodeCount;
+        uint64_t edgeCount;
+        uint64_t targetsOffset;
+        uint64_t weightsOffset;
+        uint64_t offsetsOffset;
+        uint64_t reserved;
+    };
+
+    static_assert(sizeof(MappedCSRHeader) == 64, "MappedCSRHeader must be 64 bytes");
+
+    const char MAPPED_CSR_MAGIC[8] = {'S', 'T', 'E', 'L', 'L', 'A', 'C', 'S'};
+
+    template<typename C>
+    uint32_t mappedWeightKind() {
+        static_assert(std::is_same<C, int64_t>::value || std::is_same<C, double>::value,
+            "Mapped CSR weights must be int64_t or double");
+        return std::is_same<C, double>::value ? 1 : 0;
+    }
+
+    inline string systemError(const string& message) {
+        return message + ": " + std::strerror(errno);
+    }
+
+    /*
+        Writes a mapped CSR file one row at a time, in node order. Targets go straight
+        to the file and weights to a side file appended by `finish()`, so only the
+        offsets (8 bytes per node) stay in memory. An unfinished file is removed.
+    */
+    template<typename C>
+    class MappedCSRWriter {
+        protected:
+            string path;
+            string weightsPath;
+            FILE* file = nullptr;
+            FILE* weightsFile = nullptr;
+            vector<uint64_t> offsets;
+
+            void write(FILE* out, const void* data, size_t size, size_t count) {
+                if (count && fwrite(data, size, count, out) != count)
+                    throw runtime_error(systemError("MappedCSRWriter failed to write " + path));
+            }
+            void close() {
+                if (file) fclose(file);
+                if (weightsFile) fclose(weightsFile);
+                file = weightsFile = nullptr;
+            }
+        public:
+            MappedCSRWriter(const string& path) : path(path), weightsPath(path + ".weights.tmp"), offsets(1, 0) {
+                mappedWeightKind<C>();
+                file = fopen(path.c_str(), "wb");
+                if (!file) throw runtime_error(systemError("MappedCSRWriter cannot open " + path));
+                weightsFile = fopen(weightsPath.c_str(), "w+b");
+                if (!weightsFile) {
+                    close();
+                    std::remove(path.c_str());
+                    throw runtime_error(systemError("MappedCSRWriter cannot open " + weightsPath));
+                }
+                MappedCSRHeader header = {};
+                write(file, &header, sizeof(header), 1);
+            }
+            MappedCSRWriter(const MappedCSRWriter&) = delete;
+            MappedCSRWriter& operator=(const MappedCSRWriter&) = delete;
+            ~MappedCSRWriter() {
+                if (!file) return;
+                close();
+                std::remove(path.c_str());
+                std::remove(weightsPath.c_str());
+            }
+
+            void appendRow(const int64_t* targets, const C* weights, size_t count) {
+                write(file, targets, sizeof(int64_t), count);
+                write(weightsFile, weights, sizeof(C), count);
+                offsets.push_back(offsets.back() + count);
+            }
+            void finish() {
+                MappedCSRHeader header = {};
+                std::memcpy(header.magic, MAPPED_CSR_MAGIC, sizeof(header.magic));
+                header.version = 1;
+                header.weightKind = mappedWeightKind<C>();
+                header.nodeCount = offsets.size() - 1;
+                header.edgeCount = offsets.back();
+                header.targetsOffset = sizeof(header);
+                header.weightsOffset = header.targetsOffset + header.edgeCount * sizeof(int64_t);
+                header.offsetsOffset = header.weightsOffset + header.edgeCount * sizeof(C);
+
+                rewind(weightsFile);
+                vector<char> buffer(1 << 20);
+                size_t read;
+                while ((read = fread(buffer.data(), 1, buffer.size(), weightsFile)) > 0)
+                    write(file, buffer.data(), 1, read);
+                if (ferror(weightsFile))
+                    throw runtime_error(systemError("MappedCSRWriter failed to read " + weightsPath));
+                write(file, offsets.data(), sizeof(uint64_t), offsets.size());
+                if (fseek(file, 0, SEEK_SET) != 0)
+                    throw runtime_error(systemError("MappedCSRWriter failed to write " + path));
+                write(file, &header, sizeof(header), 1);
+
+                int status = fclose(file);
+                file = nullptr;
+                fclose(weightsFile);
+                weightsFile = nullptr;
+                std::remove(weightsPath.c_str());
+                if (status != 0) {
+                    std::remove(path.c_str());
+                    throw runtime_error(systemError("MappedCSRWriter failed to write " + path));
+                }
+            }
+    };
+
+    template<typename C>
+    void writeMappedCSR(const string& path, const BasicCSR<C>& csr) {
+        MappedCSRWriter<C> writer(path);
+        for (int64_t node = 0; node < csr.nodeCount(); node++) {
+            int64_t begin = csr.offsets[node];
+            writer.appendRow(csr.targets.data() + begin, csr.weights.data() + begin,
+                csr.offsets[node + 1] - begin);
+        }
+        writer.finish();
+    }
+
+    /*
+        Read-only CSR over a mapped file. Pages are loaded by the kernel on access, so
+        graphs larger than RAM can be read; to keep the resident set bounded, whole
+        graph passes go through `forEachPartition`, which walks the nodes in order in
+        partitions of about `residentBytes / 2` of adjacency, asks the kernel to read
+        each partition ahead (MADV_WILLNEED) and to drop it once done (MADV_DONTNEED).
+        The algorithms below work that way, keeping only O(V) state in memory.
+    */
+    template<typename C>
+    class BasicMappedCSR {
+        protected:
+            int descriptor = -1;
+            void* mapping = nullptr;
+            size_t mappedSize = 0;
+            size_t residentBytes;
+            MappedCSRHeader header;
+            const int64_t* targetArray = nullptr;
+            const C* weightArray = nullptr;
+            const uint64_t* offsetArray = nullptr;
+
+            void advise(const void* begin, const void* end, int advice) const {
+                static const uintptr_t page = sysconf(_SC_PAGESIZE);
+                uintptr_t first = reinterpret_cast<uintptr_t>(begin) & ~(page - 1);
+                uintptr_t last = reinterpret_cast<uintptr_t>(end);
+                if (last > first) madvise(reinterpret_cast<void*>(first), last - first, advice);
+            }
+            void adviseNodes(int64_t begin, int64_t end, bool withWeights, int advice) const {
+                advise(targetArray + offsetArray[begin], targetArray + offsetArray[end], advice);
+                if (withWeights) advise(weightArray + offsetArray[begin], weightArray + offsetArray[end], advice);
+                advise(offsetArray + begin, offsetArray + end + 1, advice);
+            }
+            void release() {
+                if (mapping) munmap(mapping, mappedSize);
+                if (descriptor >= 0) ::close(descriptor);
+                mapping = nullptr;
+                descriptor = -1;
+            }
+        public:
+            BasicMappedCSR(const string& path, size_t residentBytes = size_t(256) << 20)
+                : residentBytes(std::max<size_t>(residentBytes, 1 << 16)) {
+                descriptor = open(path.c_str(), O_RDONLY);
+                if (descriptor < 0) throw runtime_error(systemError("MappedCSR cannot open " + path));
+                struct stat info;
+                if (fstat(descriptor, &info) != 0 || size_t(info.st_size) < sizeof(MappedCSRHeader)) {
+                    release();
+                    throw runtime_error("MappedCSR file is too short: " + path);
+                }
+                mappedSize = info.st_size;
+                mapping = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, descriptor, 0);
+                if (mapping == MAP_FAILED) {
+                    mapping = nullptr;
+                    release();
+                    throw runtime_error(systemError("MappedCSR cannot map " + path));
+                }
+
+                std::memcpy(&header, mapping, sizeof(header));
+                const char* base = static_cast<const char*>(mapping);
+                bool valid = std::memcmp(header.magic, MAPPED_CSR_MAGIC, sizeof(header.magic)) == 0
+                    && header.version == 1
+                    && header.offsetsOffset + (header.nodeCount + 1) * sizeof(uint64_t) == mappedSize;
+                if (!valid) {
+                    release();
+                    throw runtime_error("Not a mapped CSR file: " + path);
+                }
+                if (header.weightKind != mappedWeightKind<C>()) {
+                    release();
+                    throw runtime_error("Mapped CSR weights are of another type: " + path);
+                }
+                targetArray = reinterpret_cast<const int64_t*>(base + header.targetsOffset);
+                weightArray = reinterpret_cast<const C*>(base + header.weightsOffset);
+                offsetArray = reinterpret_cast<const uint64_t*>(base + header.offsetsOffset);
+                madvise(mapping, mappedSize, MADV_SEQUENTIAL);
+            }
+            BasicMappedCSR(const BasicMappedCSR&) = delete;
+            BasicMappedCSR& operator=(const BasicMappedCSR&) = delete;
+            ~BasicMappedCSR() {
+                release();
+            }
+
+            int64_t nodeCount() const {
+                return header.nodeCount;
+            }
+            uint64_t edgeCount() const {
+                return header.edgeCount;
+            }
+            const uint64_t* offsets() const {
+                return offsetArray;
+            }
+            const int64_t* targets() const {
+                return targetArray;
+            }
+            const C* weights() const {
+                return weightArray;
+            }
+
+            /*
+                Calls `visit(begin, end)` for consecutive node ranges covering every node.
+                Only targets and offsets are read ahead unless `withWeights` is set, so
+                unweighted passes do not load the weights from disk.
+            */
+            template<typename F>
+            void forEachPartition(F visit, bool withWeights = false) const {
+                size_t edgeBytes = sizeof(int64_t) + (withWeights ? sizeof(C) : 0);
+                uint64_t budget = std::max<uint64_t>(1, residentBytes / 2 / edgeBytes);
+                int64_t begin = 0;
+                while (begin < nodeCount()) {
+                    // Furthest node whose edges still fit in the budget, at least one node.
+                    const uint64_t* limit = std::upper_bound(offsetArray + begin + 1,
+                        offsetArray + nodeCount() + 1, offsetArray[begin] + budget);
+                    int64_t end = std::max<int64_t>(begin + 1, limit - offsetArray - 1);
+                    adviseNodes(begin, end, withWeights, MADV_WILLNEED);
+                    visit(begin, end);
+                    adviseNodes(begin, end, withWeights, MADV_DONTNEED);
+                    begin = end;
+                }
+            }
+    };
+
+    typedef BasicMappedCSR<int64_t> MappedCSR;
+
+    // Same numbering as connectedComponents on a CSR, in a single pass over the file.
+    template<typename C>
+    vector<int64_t> connectedComponents(const BasicMappedCSR<C>& csr) {
+        BasicUnionFind<int64_t> sets(csr.nodeCount());
+        const uint64_t* offsets = csr.offsets();
+        const int64_t* targets = csr.targets();
+        csr.forEachPartition([&](int64_t begin, int64_t end) {
+            for (int64_t node = begin; node < end; node++)
+                for (uint64_t e = offsets[node]; e < offsets[node + 1]; e++) sets.unite(node, targets[e]);
+        });
+        vector<int64_t> labels(csr.nodeCount());
+        vector<int64_t> numbers(csr.nodeCount(), -1);
+        int64_t count = 0;
+        for (int64_t node = 0; node < csr.nodeCount(); node++) {
+            int64_t& number = numbers[sets.find(node)];
+            if (number < 0) number = count++;
+            labels[node] = number;
+        }
+        return labels;
+    }
+
+    // Level by level, one pass over the file per BFS level; best on small-world graphs.
+    template<typename C>
+    vector<int64_t> bfsDistances(const BasicMappedCSR<C>& csr, int64_t source) {
+        if (source < 0 || source >= csr.nodeCount())
+            throw invalid_argument("Source node index out of range: " + std::to_string(source));
+        vector<int64_t> distances(csr.nodeCount(), -1);
+        distances[source] = 0;
+        const uint64_t* offsets = csr.offsets();
+        const int64_t* targets = csr.targets();
+        for (int64_t level = 0, reached = 1; reached > 0; level++) {
+            reached = 0;
+            csr.forEachPartition([&](int64_t begin, int64_t end) {
+                for (int64_t node = begin; node < end; node++) {
+                    if (distances[node] != level) continue;
+                    for (uint64_t e = offsets[node]; e < offsets[node + 1]; e++) {
+                        if (distances[targets[e]] >= 0) continue;
+                        distances[targets[e]] = level + 1;
+                        reached++;
+                    }
+                }
+            });
+        }
+        return distances;
+    }
+
+    // Same as pageRank on a CSR, pushing ranks along the edges in one pass per iteration.
+    template<typename C>
+    vector<double> pageRank(const BasicMappedCSR<C>& csr, double damping = 0.85,
+        int iterations = 100, double tolerance = 1e-6) {
+        int64_t nodeCount = csr.nodeCount();
+        if (nodeCount == 0) return vector<double>();
+        if (damping < 0 || damping > 1) throw invalid_argument("PageRank damping must be between 0 and 1");
+
+        const uint64_t* offsets = csr.offsets();
+        const int64_t* targets = csr.targets();
+        vector<double> rank(nodeCount, 1.0 / nodeCount), next(nodeCount);
+        for (int iteration = 0; iteration < iterations; iteration++) {
+            std::fill(next.begin(), next.end(), 0.0);
+            double dangling = 0;
+            csr.forEachPartition([&](int64_t begin, int64_t end) {
+                for (int64_t node = begin; node < end; node++) {
+                    uint64_t degree = offsets[node + 1] - offsets[node];
+                    if (!degree) {
+                        dangling += rank[node];
+                        continue;
+                    }
+                    double share = rank[node] / degree;
+                    for (uint64_t e = offsets[node]; e < offsets[node + 1]; e++) next[targets[e]] += share;
+                }
+            });
+            double base = (1 - damping) / nodeCount + damping * dangling / nodeCount;
+            double change = 0;
+            for (int64_t node = 0; node < nodeCount; node++) {
+                next[node] = base + damping * next[node];
+                change += std::fabs(next[node] - rank[node]);
+            }
+            rank.swap(next);
+            if (change < tolerance) break;
+        }
+        return rank;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef MEMORY_HPP
+#define MEMORY_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+using std::string;
+
+/*
+    Memory footprint accounting for the graph classes (`Graph::memoryUsage()`).
+
+    The numbers are computed from the containers, not measured: each heap block is
+    counted by the size the allocator hands out for it, assuming a glibc-like malloc
+    (16-byte chunks with an 8-byte header) and libstdc++ node layouts. Memory of the
+    graph object itself and anything held outside of it (Python wrappers, for instance)
+    is not included.
+*/
+
+namespace stella {
+    struct MemoryUsage {
+        // Node and edge objects themselves, inside their make_shared blocks.
+        size_t nodes = 0;
+        size_t edges = 0;
+        // Heap buffers of labels too long for the small string buffer, including the
+        // copies used as map and index keys.
+        size_t labels = 0;
+        // shared_ptr reference counts, plus allocator rounding of the shared blocks.
+        size_t controlBlocks = 0;
+        // Vector buffers, tree and hash nodes and hash buckets of the indexes.
+        size_t containers = 0;
+        // AdjMatrix only: the V x V cell maps and the tree nodes stored in them.
+        size_t matrixCells = 0;
+
+        size_t total() const {
+            return nodes + edges + labels + controlBlocks + containers + matrixCells;
+        }
+    };
+
+    // Size of the heap block that serves a request of `bytes`.
+    inline size_t allocationSize(size_t bytes) {
+        if (bytes == 0) return 0;
+        size_t chunk = (bytes + sizeof(size_t) + 15) & ~size_t(15);
+        return chunk < 32 ? 32 : chunk;
+    }
+
+    // Heap bytes of a string; short strings live inside the object and count as zero.
+    inline size_t labelBytes(const string& label) {
+        const char* data = label.data();
+        const char* object = reinterpret_cast<const char*>(&label);
+        if (data >= object && data < object + sizeof(string)) return 0;
+        return allocationSize(label.capacity() + 1);
+    }
+
+    // Reference counts and vtable pointer that make_shared places next to the object.
+    const size_t SHARED_COUNTS_SIZE = 2 * sizeof(int) + sizeof(void*);
+
+    // Adds one object of type T created by make_shared: the object goes to `objects`,
+    // the counts and the rounding of its block to `controlBlocks`.
+    template<typename T>
+    void addShared(MemoryUsage& usage, size_t& objects) {
+        objects += sizeof(T);
+        usage.controlBlocks += allocationSize(SHARED_COUNTS_SIZE + sizeof(T)) - sizeof(T);
+    }
+
+    // One red-black tree node of std::map: color, parent, left and right, then the value.
+    template<typename Map>
+    size_t treeNodeSize() {
+        return allocationSize(4 * sizeof(void*) + sizeof(typename Map::value_type));
+    }
+
+    // One std::unordered_map node: next pointer, value and the cached hash, plus the bucket
+    // array. A table with a single bucket uses one stored inline, without allocating.
+    template<typename Map>
+    size_t hashTableSize(const Map& table) {
+        size_t node = allocationSize(sizeof(void*) + sizeof(typename Map::value_type) + sizeof(size_t));
+        size_t buckets = table.bucket_count() > 1 ? allocationSize(table.bucket_count() * sizeof(void*)) : 0;
+        return table.size() * node + buckets;
+    }
+
+    template<typename Vector>
+    size_t vectorSize(const Vector& items) {
+        return allocationSize(items.capacity() * sizeof(typename Vector::value_type));
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef PARALLEL_TPP
+#define PARALLEL_TPP
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+using std::vector;
+
+namespace stella {
+    // 0 asks for one thread per hardware thread.
+    inline unsigned resolveThreads(unsigned threads) {
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        return threads == 0 ? 1 : threads;
+    }
+
+    /*
+        Splits [0, count) into one contiguous block per thread and calls
+        `body(begin, end, thread)` for each block, with `thread` below
+        `resolveThreads(threads)`. Ranges of fewer than `grain` items per thread
+        are not worth spawning for and run on fewer threads, possibly inline.
+        The first exception thrown by a block is rethrown once all blocks are done.
+    */
+    template<typename F>
+    void parallelFor(size_t count, unsigned threads, size_t grain, F body) {
+        size_t workers = std::min<size_t>(resolveThreads(threads), count / std::max<size_t>(grain, 1));
+        if (workers <= 1) {
+            if (count > 0) body(size_t(0), count, 0u);
+            return;
+        }
+
+        size_t block = (count + workers - 1) / workers;
+        vector<std::exception_ptr> errors(workers);
+        vector<std::thread> spawned;
+        spawned.reserve(workers - 1);
+        auto run = [&](unsigned thread) {
+            size_t begin = thread * block;
+            size_t end = std::min(count, begin + block);
+            try {
+                if (begin < end) body(begin, end, thread);
+            } catch (...) {
+                errors[thread] = std::current_exception();
+            }
+        };
+        for (unsigned thread = 1; thread < workers; thread++)
+            spawned.emplace_back(run, thread);
+        run(0);
+        for (std::thread& worker : spawned) worker.join();
+        for (std::exception_ptr& error : errors)
+            if (error) std::rethrow_exception(error);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,246 @@
+#ifndef POLICY_GRAPH_TPP
+#define POLICY_GRAPH_TPP
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "csr.tpp"
+#include "edge.hpp"
+#include "memory.hpp"
+
+using std::invalid_argument;
+using std::is_same;
+using std::string;
+using std::uint32_t;
+using std::unordered_map;
+using std::vector;
+
+namespace stella {
+    /*
+        Compact graph whose features are chosen at compile time, one policy each:
+
+        * direction: `Directed` or `Undirected`;
+        * parallel edges: `Simple` graphs reject a second edge between the same nodes,
+          `Multi` graphs accept it without looking;
+        * weights: any weight type, or `Unweighted` (see edge.hpp);
+        * edge labels: `Labeled` edges have a unique label, `Unlabeled` ones have none.
+
+        Nodes are addressed by label, like in the other graph classes, but edges are not
+        objects: each node keeps a vector of `Arc`s holding the target index and only the
+        weight and label id its policies ask for. An unweighted, unlabeled arc is 4 bytes,
+        and the unused policies add no branches to `addEdge`.
+        Non-directed edges are stored in the arcs of both nodes, self-loops once.
+    */
+    struct Directed {};
+    struct Undirected {};
+    struct Simple {};
+    struct Multi {};
+    struct Labeled {};
+    struct Unlabeled {};
+
+    template<typename W>
+    struct ArcWeight {
+        W weight;
+        ArcWeight(W weight) : weight(weight) {}
+        W getWeight() const { return weight; }
+    };
+
+    template<>
+    struct ArcWeight<Unweighted> {
+        ArcWeight(int weight) {}
+        int getWeight() const { return 1; }
+    };
+
+    template<typename L> struct ArcLabel;
+
+    template<>
+    struct ArcLabel<Labeled> {
+        uint32_t edge;
+        ArcLabel(uint32_t edge) : edge(edge) {}
+    };
+
+    template<>
+    struct ArcLabel<Unlabeled> {
+        ArcLabel(uint32_t edge) {}
+    };
+
+    template<typename W, typename L>
+    struct Arc: ArcWeight<W>, ArcLabel<L> {
+        uint32_t target;
+        Arc(uint32_t target, typename weight_value<W>::type weight, uint32_t edge)
+            : ArcWeight<W>(weight), ArcLabel<L>(edge), target(target) {}
+    };
+
+    // Edge label storage of `Labeled` graphs; empty for `Unlabeled` ones.
+    template<typename L> class EdgeLabels;
+
+    template<>
+    class EdgeLabels<Unlabeled> {
+        protected:
+            void addLabelUsage(MemoryUsage& usage) const {}
+    };
+
+    template<>
+    class EdgeLabels<Labeled> {
+        protected:
+            vector<string> labels;
+            unordered_map<string, uint32_t> labelIndex;
+            uint32_t insertLabel(const string& label) {
+                if (!labelIndex.emplace(label, labels.size()).second)
+                    throw invalid_argument("Edge already exists: " + label);
+                labels.push_back(label);
+                return labels.size() - 1;
+            }
+            void addLabelUsage(MemoryUsage& usage) const {
+                usage.containers += vectorSize(labels) + hashTableSize(labelIndex);
+                for (const string& label : labels) usage.labels += 2 * labelBytes(label);
+            }
+        public:
+            template<typename W>
+            const string& getEdgeLabel(const Arc<W, Labeled>& arc) const {
+                return labels[arc.edge];
+            }
+            bool hasEdgeLabel(const string& label) const {
+                return labelIndex.count(label) != 0;
+            }
+    };
+
+    template<typename D = Undirected, typename M = Simple, typename W = Unweighted, typename L = Unlabeled>
+    class PolicyGraph: public EdgeLabels<L> {
+        static_assert(is_same<D, Directed>::value || is_same<D, Undirected>::value,
+            "D must be stella::Directed or stella::Undirected");
+        static_assert(is_same<M, Simple>::value || is_same<M, Multi>::value,
+            "M must be stella::Simple or stella::Multi");
+        public:
+            typedef typename weight_value<W>::type Weight;
+            typedef Arc<W, L> ArcType;
+            static const bool directed = is_same<D, Directed>::value;
+        protected:
+            vector<string> nodes;
+            unordered_map<string, uint32_t> nodeIndex;
+            vector<vector<ArcType>> arcs;
+            size_t edgeCount = 0;
+
+            bool joined(uint32_t u, uint32_t v) const {
+                for (const ArcType& arc : arcs[u])
+                    if (arc.target == v) return true;
+                return false;
+            }
+            void checkParallel(uint32_t u, uint32_t v, Simple) const {
+                if (joined(u, v))
+                    throw invalid_argument("Edge already exists: " + nodes[u] + " " + nodes[v]);
+            }
+            void checkParallel(uint32_t u, uint32_t v, Multi) const {}
+            void link(uint32_t u, uint32_t v, Weight weight, uint32_t edge, Directed) {
+                arcs[u].emplace_back(v, weight, edge);
+            }
+            void link(uint32_t u, uint32_t v, Weight weight, uint32_t edge, Undirected) {
+                arcs[u].emplace_back(v, weight, edge);
+                if (u != v) arcs[v].emplace_back(u, weight, edge);
+            }
+            void checkIndex(uint32_t u, uint32_t v) const {
+                if (u >= nodes.size() || v >= nodes.size())
+                    throw invalid_argument("Node index out of range: "
+                        + std::to_string(u) + " " + std::to_string(v));
+            }
+            uint32_t indexOf(const string& label) const {
+                auto it = nodeIndex.find(label);
+                if (it == nodeIndex.end()) throw invalid_argument("Node label not found: " + label);
+                return it->second;
+            }
+        public:
+            PolicyGraph() {}
+            uint32_t addNode(const string& label) {
+                if (!nodeIndex.emplace(label, nodes.size()).second)
+                    throw invalid_argument("Node already exists: " + label);
+                nodes.push_back(label);
+                arcs.emplace_back();
+                return nodes.size() - 1;
+            }
+            void reserve(size_t nodeCount) {
+                nodes.reserve(nodeCount);
+                nodeIndex.reserve(nodeCount);
+                arcs.reserve(nodeCount);
+            }
+
+            // Unlabeled graphs.
+            void addEdgeByIndex(uint32_t u, uint32_t v, Weight weight = Weight(1)) {
+                static_assert(is_same<L, Unlabeled>::value, "Labeled graphs need an edge label");
+                checkIndex(u, v);
+                checkParallel(u, v, M());
+                link(u, v, weight, 0, D());
+                edgeCount++;
+            }
+            void addEdge(const string& n1, const string& n2, Weight weight = Weight(1)) {
+                addEdgeByIndex(indexOf(n1), indexOf(n2), weight);
+            }
+
+            // Labeled graphs.
+            void addEdgeByIndex(const string& label, uint32_t u, uint32_t v, Weight weight = Weight(1)) {
+                static_assert(is_same<L, Labeled>::value, "Unlabeled graphs take no edge label");
+                checkIndex(u, v);
+                checkParallel(u, v, M());
+                link(u, v, weight, this->insertLabel(label), D());
+                edgeCount++;
+            }
+            void addEdge(const string& label, const string& n1, const string& n2, Weight weight = Weight(1)) {
+                addEdgeByIndex(label, indexOf(n1), indexOf(n2), weight);
+            }
+
+            int getNodeIndex(const string& label) const {
+                auto it = nodeIndex.find(label);
+                if (it != nodeIndex.end()) return it->second;
+                return -1;
+            }
+            const string& getNodeLabel(uint32_t index) const {
+                return nodes[index];
+            }
+            size_t getNodeCount() const {
+                return nodes.size();
+            }
+            size_t getEdgeCount() const {
+                return edgeCount;
+            }
+            bool hasEdge(uint32_t u, uint32_t v) const {
+                return u < nodes.size() && v < nodes.size() && joined(u, v);
+            }
+            // Outgoing arcs of `u`; for non-directed graphs, every edge touching it.
+            const vector<ArcType>& getArcs(uint32_t u) const {
+                return arcs[u];
+            }
+            MemoryUsage memoryUsage() const {
+                MemoryUsage usage;
+                usage.containers += vectorSize(nodes) + hashTableSize(nodeIndex) + vectorSize(arcs);
+                for (const string& label : nodes) usage.labels += 2 * labelBytes(label);
+                for (const vector<ArcType>& list : arcs) usage.edges += vectorSize(list);
+                this->addLabelUsage(usage);
+                return usage;
+            }
+    };
+
+    // Arcs already are the adjacency, so they are copied row by row.
+    template<typename D, typename M, typename W, typename L>
+    BasicCSR<GraphCost<PolicyGraph<D, M, W, L>>> toCSR(PolicyGraph<D, M, W, L>& graph) {
+        typedef typename PolicyGraph<D, M, W, L>::ArcType ArcType;
+        size_t nodeCount = graph.getNodeCount();
+        BasicCSR<GraphCost<PolicyGraph<D, M, W, L>>> csr;
+        csr.offsets.assign(nodeCount + 1, 0);
+        for (size_t i = 0; i < nodeCount; i++)
+            csr.offsets[i + 1] = csr.offsets[i] + graph.getArcs(i).size();
+        csr.targets.reserve(csr.offsets[nodeCount]);
+        csr.weights.reserve(csr.offsets[nodeCount]);
+        for (size_t i = 0; i < nodeCount; i++) {
+            for (const ArcType& arc : graph.getArcs(i)) {
+                csr.targets.push_back(arc.target);
+                csr.weights.push_back(arc.getWeight());
+            }
+        }
+        return csr;
+    }
+}
+
+#endif
\ No newline at end of file
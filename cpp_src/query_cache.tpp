@@ -0,0 +1,165 @@
+#ifndef QUERY_CACHE_TPP
+#define QUERY_CACHE_TPP
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "algorithms.tpp"
+#include "csr.tpp"
+
+using std::invalid_argument;
+using std::list;
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+using std::uint64_t;
+using std::unordered_map;
+using std::vector;
+
+namespace stella {
+    /*
+        Least recently used cache of at most `capacity` results. Every entry records the
+        graph epoch (`Graph::getEpoch()`) it was computed at, and only a lookup at that
+        same epoch finds it: results of an older graph are dropped when met, or pushed
+        out by newer ones, without the graph having to notify the cache.
+    */
+    template<typename K, typename V, typename Hash = std::hash<K>>
+    class LRUCache {
+        protected:
+            struct Entry {
+                K key;
+                uint64_t epoch;
+                V value;
+            };
+            size_t capacity;
+            // Most recently used first.
+            list<Entry> order;
+            unordered_map<K, typename list<Entry>::iterator, Hash> index;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        public:
+            // A capacity of 0 disables the cache: every lookup misses.
+            LRUCache(size_t capacity) : capacity(capacity) {}
+            const V* find(const K& key, uint64_t epoch) {
+                auto it = index.find(key);
+                if (it == index.end()) {
+                    misses++;
+                    return nullptr;
+                }
+                if (it->second->epoch != epoch) {
+                    order.erase(it->second);
+                    index.erase(it);
+                    misses++;
+                    return nullptr;
+                }
+                order.splice(order.begin(), order, it->second);
+                hits++;
+                return &it->second->value;
+            }
+            void insert(const K& key, uint64_t epoch, V value) {
+                if (capacity == 0) return;
+                auto it = index.find(key);
+                if (it != index.end()) {
+                    it->second->epoch = epoch;
+                    it->second->value = std::move(value);
+                    order.splice(order.begin(), order, it->second);
+                    return;
+                }
+                order.push_front({key, epoch, std::move(value)});
+                index.emplace(key, order.begin());
+                if (order.size() > capacity) {
+                    index.erase(order.back().key);
+                    order.pop_back();
+                }
+            }
+            void clear() {
+                order.clear();
+                index.clear();
+            }
+            size_t size() const {
+                return order.size();
+            }
+            uint64_t getHits() const {
+                return hits;
+            }
+            uint64_t getMisses() const {
+                return misses;
+            }
+    };
+
+    /*
+        Memoized queries over one graph. The CSR adjacency is built once per graph epoch,
+        and the per-source results are kept in LRU caches of `capacity` entries each,
+        keyed by source node and epoch, so that any change to the graph invalidates
+        them. Results are shared, immutable, and stay valid after they leave the cache.
+        Not thread safe: use one CachedQueries per thread, or lock around it.
+    */
+    template<typename G>
+    class CachedQueries {
+        public:
+            typedef GraphCost<G> Cost;
+        protected:
+            G& graph;
+            uint64_t csrEpoch = 0;
+            shared_ptr<const BasicCSR<Cost>> csr;
+            LRUCache<int64_t, shared_ptr<const BasicShortestPaths<Cost>>> paths;
+            LRUCache<int64_t, shared_ptr<const vector<int64_t>>> hops;
+
+            int64_t indexOf(const string& label) {
+                int index = graph.getNodeIndex(label);
+                if (index < 0) throw invalid_argument("Node labels not found: " + label);
+                return index;
+            }
+        public:
+            CachedQueries(G& graph, size_t capacity = 1024) : graph(graph), paths(capacity), hops(capacity) {}
+            shared_ptr<const BasicCSR<Cost>> getCSR() {
+                if (!csr || csrEpoch != graph.getEpoch()) {
+                    csr = make_shared<BasicCSR<Cost>>(toCSR(graph));
+                    csrEpoch = graph.getEpoch();
+                }
+                return csr;
+            }
+            // Dijkstra from `source`, see shortestPaths in algorithms.tpp.
+            shared_ptr<const BasicShortestPaths<Cost>> shortestPaths(const string& source) {
+                int64_t index = indexOf(source);
+                uint64_t epoch = graph.getEpoch();
+                if (auto cached = paths.find(index, epoch)) return *cached;
+                auto result = make_shared<BasicShortestPaths<Cost>>(stella::shortestPaths(*getCSR(), {index}));
+                paths.insert(index, epoch, result);
+                return result;
+            }
+            // BFS hop distances from `source`, -1 where it does not reach.
+            shared_ptr<const vector<int64_t>> bfsDistances(const string& source) {
+                int64_t index = indexOf(source);
+                uint64_t epoch = graph.getEpoch();
+                if (auto cached = hops.find(index, epoch)) return *cached;
+                auto result = make_shared<vector<int64_t>>(stella::bfsDistances(*getCSR(), index));
+                hops.insert(index, epoch, result);
+                return result;
+            }
+            // Whether a path leads from `from` to `to`, following edge directions.
+            bool reachable(const string& from, const string& to) {
+                int64_t target = indexOf(to);
+                return (*bfsDistances(from))[target] >= 0;
+            }
+            uint64_t getHits() const {
+                return paths.getHits() + hops.getHits();
+            }
+            uint64_t getMisses() const {
+                return paths.getMisses() + hops.getMisses();
+            }
+            void clear() {
+                csr.reset();
+                paths.clear();
+                hops.clear();
+            }
+    };
+}
+
+#endif
\ No newline at end of file
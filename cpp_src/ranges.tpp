@@ -0,0 +1,412 @@
+#ifndef RANGES_TPP
+#define RANGES_TPP
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define STELLA_COROUTINES 1
+#endif
+#endif
+
+#include "adj_list.tpp"
+#include "adj_matrix.tpp"
+
+using std::invalid_argument;
+using std::map;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+/*
+    Lazy ranges over the nodes, edges and neighbors of AdjList, AdjMatrix and their
+    directed versions. They read the graph containers in place, without copying
+    them, and `filter` and `transform` wrap the iterators instead of building
+    intermediate results, so that
+
+        for (auto& edge : incidentEdges(graph, "a").filter(lighterThan5)) ...
+
+    compiles down to a loop over the incidence list with an inlined test. Ranges
+    and their iterators are only valid until the graph changes.
+
+    Built with coroutine support (C++20), `bfsOrder` and `dfsOrder` are generators
+    that visit the nodes lazily, one step of the traversal per node.
+*/
+
+namespace stella {
+    template<typename It, typename P>
+    class FilterIterator {
+        protected:
+            It current;
+            It last;
+            P predicate;
+            void skip() {
+                while (current != last && !predicate(*current)) ++current;
+            }
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef typename std::iterator_traits<It>::value_type value_type;
+            typedef typename std::iterator_traits<It>::reference reference;
+            typedef typename std::iterator_traits<It>::pointer pointer;
+            typedef std::ptrdiff_t difference_type;
+
+            FilterIterator(It current, It last, P predicate) : current(current), last(last), predicate(predicate) {
+                skip();
+            }
+            reference operator*() const { return *current; }
+            FilterIterator& operator++() {
+                ++current;
+                skip();
+                return *this;
+            }
+            bool operator==(const FilterIterator& other) const { return !(current != other.current); }
+            bool operator!=(const FilterIterator& other) const { return current != other.current; }
+    };
+
+    template<typename It, typename F>
+    class TransformIterator {
+        protected:
+            It current;
+            F function;
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef decltype(std::declval<const F&>()(*std::declval<It>())) reference;
+            typedef typename std::decay<reference>::type value_type;
+            typedef void pointer;
+            typedef std::ptrdiff_t difference_type;
+
+            TransformIterator(It current, F function) : current(current), function(function) {}
+            reference operator*() const { return function(*current); }
+            TransformIterator& operator++() {
+                ++current;
+                return *this;
+            }
+            bool operator==(const TransformIterator& other) const { return !(current != other.current); }
+            bool operator!=(const TransformIterator& other) const { return current != other.current; }
+    };
+
+    // A pair of iterators, with adaptors that return new ranges over the same items.
+    template<typename It>
+    class Range {
+        protected:
+            It first;
+            It last;
+        public:
+            typedef typename std::iterator_traits<It>::reference reference;
+            typedef typename std::iterator_traits<It>::value_type value_type;
+
+            Range(It first, It last) : first(first), last(last) {}
+            It begin() const { return first; }
+            It end() const { return last; }
+            bool empty() const { return !(first != last); }
+            // The items for which `predicate(item)` is true.
+            template<typename P>
+            Range<FilterIterator<It, P>> filter(P predicate) const {
+                return Range<FilterIterator<It, P>>(FilterIterator<It, P>(first, last, predicate),
+                    FilterIterator<It, P>(last, last, predicate));
+            }
+            // `function(item)` for every item, computed as the range is read.
+            template<typename F>
+            Range<TransformIterator<It, F>> transform(F function) const {
+                return Range<TransformIterator<It, F>>(TransformIterator<It, F>(first, function),
+                    TransformIterator<It, F>(last, function));
+            }
+            // Counts by walking the range: O(n).
+            size_t count() const {
+                size_t count = 0;
+                for (It it = first; it != last; ++it) count++;
+                return count;
+            }
+            vector<value_type> toVector() const {
+                vector<value_type> items;
+                for (It it = first; it != last; ++it) items.push_back(*it);
+                return items;
+            }
+    };
+
+    template<typename It>
+    Range<It> makeRange(It first, It last) {
+        return Range<It>(first, last);
+    }
+
+    struct PairSecond {
+        template<typename P>
+        typename P::second_type& operator()(P& pair) const {
+            return pair.second;
+        }
+    };
+
+    /*
+        Edges of a sequence of adjacency matrix cells, `cells(k)` for k in [0, count),
+        skipping empty cells.
+    */
+    template<typename E, typename Cells>
+    class CellIterator {
+        protected:
+            typedef typename map<string, shared_ptr<E>>::iterator CellEntry;
+            Cells cells;
+            size_t index;
+            size_t count;
+            CellEntry current;
+            CellEntry stop;
+            void settle() {
+                for (; index < count; index++) {
+                    map<string, shared_ptr<E>>& cell = cells(index);
+                    if (cell.empty()) continue;
+                    current = cell.begin();
+                    stop = cell.end();
+                    return;
+                }
+            }
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef shared_ptr<E> value_type;
+            typedef shared_ptr<E>& reference;
+            typedef shared_ptr<E>* pointer;
+            typedef std::ptrdiff_t difference_type;
+
+            CellIterator(Cells cells, size_t index, size_t count) : cells(cells), index(index), count(count) {
+                settle();
+            }
+            reference operator*() const { return current->second; }
+            CellIterator& operator++() {
+                if (++current == stop) {
+                    index++;
+                    settle();
+                }
+                return *this;
+            }
+            bool operator==(const CellIterator& other) const {
+                return index == other.index && (index == count || current == other.current);
+            }
+            bool operator!=(const CellIterator& other) const { return !(*this == other); }
+    };
+
+    template<typename E>
+    map<string, shared_ptr<E>>& emptyCell() {
+        static map<string, shared_ptr<E>> cell;
+        return cell;
+    }
+
+    // Every cell, row by row; non-directed edges only from the upper triangle.
+    template<typename E>
+    struct MatrixCells {
+        vector<vector<map<string, shared_ptr<E>>>>* rows;
+        size_t size;
+        map<string, shared_ptr<E>>& operator()(size_t k) const {
+            size_t i = k / size, j = k % size;
+            if (!is_directed<E>::value && j < i) return emptyCell<E>();
+            return (*rows)[i][j];
+        }
+    };
+
+    // The row of node `node`, then its column for directed edges.
+    template<typename E>
+    struct IncidentCells {
+        vector<vector<map<string, shared_ptr<E>>>>* rows;
+        size_t size;
+        size_t node;
+        map<string, shared_ptr<E>>& operator()(size_t k) const {
+            if (k < size) return (*rows)[node][k];
+            k -= size;
+            if (!is_directed<E>::value || k == node) return emptyCell<E>();
+            return (*rows)[k][node];
+        }
+    };
+
+    template<typename G>
+    Range<typename vector<shared_ptr<typename G::NodeType>>::iterator> allNodes(G& graph) {
+        vector<shared_ptr<typename G::NodeType>>& nodes = graph.getAllNodes();
+        return makeRange(nodes.begin(), nodes.end());
+    }
+
+    // In label order.
+    template<typename N, typename E>
+    Range<TransformIterator<typename map<string, shared_ptr<E>>::iterator, PairSecond>> allEdges(AdjList<N, E>& graph) {
+        map<string, shared_ptr<E>>& edges = graph.getAllEdges();
+        return makeRange(edges.begin(), edges.end()).transform(PairSecond());
+    }
+
+    // Row by row, each edge once. Reads every cell: O(V^2).
+    template<typename N, typename E>
+    Range<CellIterator<E, MatrixCells<E>>> allEdges(AdjMatrix<N, E>& graph) {
+        size_t size = graph.getAllNodes().size();
+        MatrixCells<E> cells{&graph.getAllEdges(), size};
+        return makeRange(CellIterator<E, MatrixCells<E>>(cells, 0, size * size),
+            CellIterator<E, MatrixCells<E>>(cells, size * size, size * size));
+    }
+
+    // Edges touching the node, incoming ones included for directed graphs. O(degree).
+    template<typename N, typename E>
+    Range<typename vector<shared_ptr<E>>::const_iterator> incidentEdges(AdjList<N, E>& graph, const string& label) {
+        const vector<shared_ptr<E>>& incident = graph.getIncidentEdges(label);
+        return makeRange(incident.begin(), incident.end());
+    }
+
+    // Reads the row of the node, and its column for directed graphs: O(V).
+    template<typename N, typename E>
+    Range<CellIterator<E, IncidentCells<E>>> incidentEdges(AdjMatrix<N, E>& graph, const string& label) {
+        int index = graph.getNodeIndex(label);
+        if (index < 0)
+            throw invalid_argument("Node not found: " + label);
+        size_t size = graph.getAllNodes().size();
+        IncidentCells<E> cells{&graph.getAllEdges(), size, size_t(index)};
+        return makeRange(CellIterator<E, IncidentCells<E>>(cells, 0, 2 * size),
+            CellIterator<E, IncidentCells<E>>(cells, 2 * size, 2 * size));
+    }
+
+    // Whether the edge leaves the node labelled `label`; every touching edge does for
+    // non-directed graphs. Ends are told apart by label, since an edge may hold its own
+    // Node objects rather than the graph's.
+    template<typename E>
+    struct LeavesNode {
+        string label;
+        bool operator()(const shared_ptr<E>& edge) const {
+            return !is_directed<E>::value || edge->n1->getLabel() == label;
+        }
+    };
+
+    template<typename E>
+    struct OtherEnd {
+        string label;
+        const shared_ptr<Node>& operator()(const shared_ptr<E>& edge) const {
+            return edge->n1->getLabel() == label ? edge->n2 : edge->n1;
+        }
+    };
+
+    // Nodes at the other end of the edges leaving the node, once per edge.
+    template<typename G>
+    auto neighbors(G& graph, const string& label)
+        -> decltype(incidentEdges(graph, label).filter(LeavesNode<typename G::EdgeType>())
+            .transform(OtherEnd<typename G::EdgeType>())) {
+        typedef typename G::EdgeType E;
+        auto incident = incidentEdges(graph, label);
+        return incident.filter(LeavesNode<E>{label}).transform(OtherEnd<E>{label});
+    }
+
+#ifdef STELLA_COROUTINES
+    // Lazily computed sequence of values, produced by a coroutine with `co_yield`.
+    template<typename T>
+    class Generator {
+        public:
+            struct promise_type {
+                const T* value = nullptr;
+                std::exception_ptr error;
+                Generator get_return_object() {
+                    return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+                std::suspend_always initial_suspend() noexcept { return {}; }
+                std::suspend_always final_suspend() noexcept { return {}; }
+                std::suspend_always yield_value(const T& yielded) noexcept {
+                    value = &yielded;
+                    return {};
+                }
+                void return_void() {}
+                void unhandled_exception() { error = std::current_exception(); }
+            };
+
+            class iterator {
+                protected:
+                    std::coroutine_handle<promise_type> handle;
+                public:
+                    typedef std::input_iterator_tag iterator_category;
+                    typedef T value_type;
+                    typedef const T& reference;
+                    typedef std::ptrdiff_t difference_type;
+
+                    explicit iterator(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+                    reference operator*() const { return *handle.promise().value; }
+                    iterator& operator++() {
+                        handle.resume();
+                        if (handle.promise().error) std::rethrow_exception(handle.promise().error);
+                        return *this;
+                    }
+                    void operator++(int) { ++*this; }
+                    bool operator==(std::default_sentinel_t) const { return handle.done(); }
+            };
+
+            explicit Generator(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+            Generator(Generator&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+            Generator(const Generator&) = delete;
+            Generator& operator=(const Generator&) = delete;
+            ~Generator() {
+                if (handle) handle.destroy();
+            }
+            // Runs the coroutine up to its first value; call once.
+            iterator begin() {
+                return ++iterator(handle);
+            }
+            std::default_sentinel_t end() {
+                return std::default_sentinel;
+            }
+        protected:
+            std::coroutine_handle<promise_type> handle;
+    };
+
+    // Nodes reachable from `label` in BFS order, following edge directions.
+    template<typename G>
+    Generator<shared_ptr<typename G::NodeType>> bfsOrder(G& graph, string label) {
+        int source = graph.getNodeIndex(label);
+        if (source < 0)
+            throw invalid_argument("Node not found: " + label);
+        vector<shared_ptr<typename G::NodeType>>& nodes = graph.getAllNodes();
+        vector<char> visited(nodes.size(), 0);
+        vector<int> queue(1, source);
+        visited[source] = 1;
+        for (size_t head = 0; head < queue.size(); head++) {
+            shared_ptr<typename G::NodeType> node = nodes[queue[head]];
+            co_yield node;
+            for (const shared_ptr<Node>& next : neighbors(graph, node->getLabel())) {
+                int index = graph.getNodeIndex(next->getLabel());
+                if (visited[index]) continue;
+                visited[index] = 1;
+                queue.push_back(index);
+            }
+        }
+    }
+
+    // Nodes reachable from `label` in DFS preorder, following edge directions.
+    template<typename G>
+    Generator<shared_ptr<typename G::NodeType>> dfsOrder(G& graph, string label) {
+        typedef decltype(neighbors(graph, label).begin()) Neighbor;
+        int source = graph.getNodeIndex(label);
+        if (source < 0)
+            throw invalid_argument("Node not found: " + label);
+        vector<shared_ptr<typename G::NodeType>>& nodes = graph.getAllNodes();
+        vector<char> visited(nodes.size(), 0);
+        // The neighbors left to try at each depth.
+        vector<std::pair<Neighbor, Neighbor>> stack;
+        visited[source] = 1;
+        shared_ptr<typename G::NodeType> node = nodes[source];
+        while (true) {
+            co_yield node;
+            auto next = neighbors(graph, node->getLabel());
+            stack.emplace_back(next.begin(), next.end());
+            node = nullptr;
+            while (!node && !stack.empty()) {
+                std::pair<Neighbor, Neighbor>& top = stack.back();
+                if (!(top.first != top.second)) {
+                    stack.pop_back();
+                    continue;
+                }
+                int index = graph.getNodeIndex((*top.first)->getLabel());
+                ++top.first;
+                if (visited[index]) continue;
+                visited[index] = 1;
+                node = nodes[index];
+            }
+            if (!node) break;
+        }
+    }
+#endif
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,186 @@
+#ifndef REORDER_TPP
+#define REORDER_TPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "algorithms.tpp"
+#include "csr.tpp"
+
+using std::int64_t;
+using std::pair;
+using std::vector;
+
+namespace stella {
+    /*
+        Node orderings that place neighbors close to each other, so that traversals
+        over the index based forms (CSR, edge arrays, algorithms) touch fewer cache
+        lines. Each returns `order`, where `order[i]` is the current index of the node
+        that becomes node `i`; `reorder()` applies it to a graph. Edge directions are
+        ignored when ordering.
+    */
+    enum ReorderStrategy { REORDER_RCM, REORDER_DEGREE, REORDER_GORDER };
+
+    // Both directions of every edge, to order directed graphs.
+    template<typename C>
+    BasicCSR<C> symmetrize(const BasicCSR<C>& csr) {
+        const BasicCSR<C> reversed = transpose(csr);
+        int64_t nodeCount = csr.nodeCount();
+        BasicCSR<C> both;
+        both.offsets.assign(nodeCount + 1, 0);
+        both.targets.reserve(csr.targets.size() * 2);
+        both.weights.reserve(csr.weights.size() * 2);
+        for (int64_t node = 0; node < nodeCount; node++) {
+            for (const BasicCSR<C>* half : {&csr, &reversed}) {
+                for (int64_t e = half->offsets[node]; e < half->offsets[node + 1]; e++) {
+                    both.targets.push_back(half->targets[e]);
+                    both.weights.push_back(half->weights[e]);
+                }
+            }
+            both.offsets[node + 1] = both.targets.size();
+        }
+        return both;
+    }
+
+    template<typename C>
+    int64_t degreeOf(const BasicCSR<C>& csr, int64_t node) {
+        return csr.offsets[node + 1] - csr.offsets[node];
+    }
+
+    // Highest degree first, ties kept in index order. `csr` must be symmetric.
+    template<typename C>
+    vector<int64_t> degreeOrder(const BasicCSR<C>& csr) {
+        vector<int64_t> order(csr.nodeCount());
+        for (size_t i = 0; i < order.size(); i++) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](int64_t first, int64_t second) {
+            return degreeOf(csr, first) > degreeOf(csr, second);
+        });
+        return order;
+    }
+
+    /*
+        Reverse Cuthill-McKee: a BFS from a lowest degree node of each component that
+        visits neighbors by increasing degree, reversed at the end. Gives a narrow
+        bandwidth, so the neighbors of a node sit at nearby indices. `csr` must be symmetric.
+    */
+    template<typename C>
+    vector<int64_t> rcmOrder(const BasicCSR<C>& csr) {
+        int64_t nodeCount = csr.nodeCount();
+        vector<int64_t> byDegree = degreeOrder(csr);
+        std::reverse(byDegree.begin(), byDegree.end());
+        vector<int64_t> order;
+        order.reserve(nodeCount);
+        vector<char> visited(nodeCount, 0);
+        vector<int64_t> neighbors;
+        for (int64_t start : byDegree) {
+            if (visited[start]) continue;
+            visited[start] = 1;
+            // The order itself is the BFS queue.
+            size_t head = order.size();
+            order.push_back(start);
+            while (head < order.size()) {
+                int64_t node = order[head++];
+                neighbors.clear();
+                for (int64_t e = csr.offsets[node]; e < csr.offsets[node + 1]; e++) {
+                    int64_t target = csr.targets[e];
+                    if (visited[target]) continue;
+                    visited[target] = 1;
+                    neighbors.push_back(target);
+                }
+                std::stable_sort(neighbors.begin(), neighbors.end(), [&](int64_t first, int64_t second) {
+                    return degreeOf(csr, first) < degreeOf(csr, second);
+                });
+                order.insert(order.end(), neighbors.begin(), neighbors.end());
+            }
+        }
+        std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+    /*
+        Gorder (Wei et al., 2016), greedy version: each next node is the one with the
+        most links into the last `window` placed nodes, counting both direct edges and
+        shared neighbors. Scores are updated as nodes enter and leave the window and
+        kept in a lazy max-heap. Shared neighbors are not counted through hubs of
+        degree above sqrt(V), which would cost quadratic time for little locality.
+        `csr` must be symmetric.
+    */
+    template<typename C>
+    vector<int64_t> gorderOrder(const BasicCSR<C>& csr, int64_t window = 5) {
+        int64_t nodeCount = csr.nodeCount();
+        int64_t hubDegree = std::max<int64_t>(16, std::sqrt(double(nodeCount)));
+        vector<int64_t> score(nodeCount, 0);
+        vector<char> placed(nodeCount, 0);
+        std::priority_queue<pair<int64_t, int64_t>> heap;
+        auto change = [&](int64_t node, int64_t delta) {
+            if (placed[node]) return;
+            score[node] += delta;
+            heap.emplace(score[node], -node);
+        };
+        auto update = [&](int64_t node, int64_t delta) {
+            for (int64_t e = csr.offsets[node]; e < csr.offsets[node + 1]; e++) {
+                int64_t neighbor = csr.targets[e];
+                change(neighbor, delta);
+                if (degreeOf(csr, neighbor) > hubDegree) continue;
+                for (int64_t f = csr.offsets[neighbor]; f < csr.offsets[neighbor + 1]; f++)
+                    if (csr.targets[f] != node) change(csr.targets[f], delta);
+            }
+        };
+
+        // Fallback when no unplaced node is linked to the window: the next by degree.
+        vector<int64_t> byDegree = degreeOrder(csr);
+        size_t next = 0;
+        vector<int64_t> order;
+        order.reserve(nodeCount);
+        while ((int64_t) order.size() < nodeCount) {
+            int64_t chosen = -1;
+            while (!heap.empty()) {
+                pair<int64_t, int64_t> top = heap.top();
+                heap.pop();
+                if (!placed[-top.second] && top.first == score[-top.second]) {
+                    chosen = -top.second;
+                    break;
+                }
+            }
+            if (chosen < 0) {
+                while (placed[byDegree[next]]) next++;
+                chosen = byDegree[next];
+            }
+            placed[chosen] = 1;
+            order.push_back(chosen);
+            update(chosen, 1);
+            if ((int64_t) order.size() > window) update(order[order.size() - 1 - window], -1);
+        }
+        return order;
+    }
+
+    // Computes the order on `csr`, symmetrizing it first for directed graphs.
+    template<typename C>
+    vector<int64_t> nodeOrder(const BasicCSR<C>& csr, ReorderStrategy strategy, bool directed) {
+        if (directed) return nodeOrder(symmetrize(csr), strategy, false);
+        switch (strategy) {
+            case REORDER_RCM: return rcmOrder(csr);
+            case REORDER_DEGREE: return degreeOrder(csr);
+            case REORDER_GORDER: return gorderOrder(csr);
+        }
+        throw invalid_argument("Unknown reorder strategy");
+    }
+
+    /*
+        Renumbers the nodes of `graph` (AdjList, AdjMatrix or their directed versions)
+        with `strategy` and returns the order applied: node `i` of the graph is now the
+        one that was at index `order[i]`. Exports and algorithms then see the new order.
+    */
+    template<typename G>
+    vector<int64_t> reorder(G& graph, ReorderStrategy strategy) {
+        vector<int64_t> order = nodeOrder(toCSR(graph), strategy, is_directed<typename G::EdgeType>::value);
+        graph.permuteNodes(order);
+        return order;
+    }
+}
+
+#endif
\ No newline at end of file
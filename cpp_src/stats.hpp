@@ -0,0 +1,106 @@
+#ifndef STATS_HPP
+#define STATS_HPP
+
+/*
+    Opt-in instrumentation of the graph classes. Compile with `-DSTELLA_STATS` and every
+    graph keeps a `GraphStats` record, read with `getStats()` and cleared with `resetStats()`:
+    call counts, failures and latency histograms of inserts and lookups, plus how often
+    the graph storage grew or moved to a new allocation.
+
+    Without STELLA_STATS the macros below expand to nothing and graphs carry no extra state.
+*/
+
+#ifdef STELLA_STATS
+
+#include <chrono>
+#include <cstdint>
+
+namespace stella {
+    // Bucket `i` counts samples of [2^i, 2^(i+1)) nanoseconds; bucket 0 also counts 0 ns.
+    struct LatencyHistogram {
+        static const int BUCKETS = 48;
+        uint64_t buckets[BUCKETS] = {};
+        uint64_t samples = 0;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+
+        void record(uint64_t ns) {
+            int bucket = 0;
+            for (uint64_t value = ns; value > 1 && bucket < BUCKETS - 1; value >>= 1) bucket++;
+            buckets[bucket]++;
+            samples++;
+            totalNs += ns;
+            if (ns > maxNs) maxNs = ns;
+        }
+        // Upper bound, in nanoseconds, of the bucket holding the `q` quantile.
+        uint64_t quantile(double q) const {
+            uint64_t rank = (uint64_t) (q * samples), seen = 0;
+            for (int i = 0; i < BUCKETS; i++) {
+                seen += buckets[i];
+                if (seen > rank) return (uint64_t(2) << i) - 1;
+            }
+            return maxNs;
+        }
+    };
+
+    struct OperationStats {
+        uint64_t count = 0;
+        uint64_t failed = 0;
+        LatencyHistogram latency;
+    };
+
+    struct GraphStats {
+        OperationStats nodeInserts;
+        OperationStats edgeInserts;
+        OperationStats nodeLookups;
+        // Lookups by edge label; only AdjList has them.
+        OperationStats edgeLookups;
+        // One sample per addNodes / addEdges call.
+        OperationStats bulkNodeInserts;
+        OperationStats bulkEdgeInserts;
+        OperationStats nodeRemovals;
+        OperationStats edgeRemovals;
+        // AdjMatrix only: the matrix gained rows and columns.
+        uint64_t growths = 0;
+        // A node vector, label index or matrix row moved to a larger allocation.
+        uint64_t reallocations = 0;
+    };
+
+    // Records one operation when it goes out of scope. It counts as failed unless
+    // marked otherwise, so operations that throw are counted as failures.
+    class StatTimer {
+        private:
+            OperationStats& stats;
+            std::chrono::steady_clock::time_point start;
+            bool ok = false;
+        public:
+            explicit StatTimer(OperationStats& stats) : stats(stats), start(std::chrono::steady_clock::now()) {}
+            void result(bool found) { ok = found; }
+            ~StatTimer() {
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                stats.count++;
+                if (!ok) stats.failed++;
+                stats.latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
+    };
+}
+
+#define STELLA_STAT_TIMER(timer, operation) stella::StatTimer timer(this->stats.operation)
+#define STELLA_STAT_SUCCEED(timer) timer.result(true)
+#define STELLA_STAT_RESULT(timer, found) timer.result(found)
+#define STELLA_STAT_EVENT(counter) (this->stats.counter++)
+#define STELLA_STAT_SNAPSHOT(name, value) size_t name = (value)
+#define STELLA_STAT_IF_CHANGED(name, value, counter) if ((size_t) (value) != name) this->stats.counter++
+
+#else
+
+#define STELLA_STAT_TIMER(timer, operation)
+#define STELLA_STAT_SUCCEED(timer)
+#define STELLA_STAT_RESULT(timer, found)
+#define STELLA_STAT_EVENT(counter)
+#define STELLA_STAT_SNAPSHOT(name, value)
+#define STELLA_STAT_IF_CHANGED(name, value, counter)
+
+#endif
+
+#endif
\ No newline at end of file
@@ -37,5 +37,17 @@
 #include "graph.tpp"
 #include "adj_list.tpp"
 #include "adj_matrix.tpp"
+#include "csr.tpp"
+#include "algorithms.tpp"
+#include "policy_graph.tpp"
+#include "concurrent_builder.tpp"
+#include "versioned_adj_list.tpp"
+#include "query_cache.tpp"
+#include "reorder.tpp"
+#include "compressed_csr.tpp"
+#include "subgraph.tpp"
+#include "generators.tpp"
+#include "ranges.tpp"
+#include "graph_factory.tpp"
 
 #endif
@@ -0,0 +1,88 @@
+#ifndef SUBGRAPH_TPP
+#define SUBGRAPH_TPP
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph.tpp"
+
+using std::invalid_argument;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+namespace stella {
+    /*
+        Subgraph extraction for AdjList, AdjMatrix and their directed versions. The
+        nodes are selected by index, then `extractSubgraph` builds the new graph in one
+        go: node and edge objects are copied, so the subgraph is independent of
+        `graph`, and node indices follow the selection order.
+    */
+
+    // Indices of the nodes with the given labels; throws if one is missing.
+    template<typename G>
+    vector<int> nodeIndices(G& graph, const vector<string>& labels) {
+        vector<int> indices;
+        indices.reserve(labels.size());
+        for (const string& label : labels) {
+            int index = graph.getNodeIndex(label);
+            if (index < 0) throw invalid_argument("Node not found: " + label);
+            indices.push_back(index);
+        }
+        return indices;
+    }
+
+    /*
+        Indices of the nodes at most `k` hops from `label`, in BFS order, `label` first.
+        Directed graphs follow outgoing edges only. The visited set is a dense vector,
+        and each reached node costs one pass over its incident edges (a row of the
+        matrix for AdjMatrix).
+    */
+    template<typename G>
+    vector<int> khopIndices(G& graph, const string& label, int k) {
+        typedef typename G::EdgeType E;
+        if (k < 0) throw invalid_argument("Hop count must be 0 or more: " + std::to_string(k));
+        int source = graph.getNodeIndex(label);
+        if (source < 0) throw invalid_argument("Node not found: " + label);
+        const vector<shared_ptr<typename G::NodeType>>& nodes = graph.getAllNodes();
+        vector<char> visited(nodes.size(), 0);
+        vector<int> order(1, source);
+        visited[source] = 1;
+        size_t head = 0;
+        for (int hop = 0; hop < k && head < order.size(); hop++) {
+            size_t levelEnd = order.size();
+            for (; head < levelEnd; head++) {
+                const shared_ptr<typename G::NodeType>& node = nodes[order[head]];
+                graph.forEachIncidentEdge(node->getLabel(), [&](const shared_ptr<E>& edge) {
+                    bool outgoing = edge->getN1()->getLabel() == node->getLabel();
+                    if (is_directed<E>::value && !outgoing) return;
+                    int other = graph.getNodeIndex((outgoing ? edge->getN2() : edge->getN1())->getLabel());
+                    if (visited[other]) return;
+                    visited[other] = 1;
+                    order.push_back(other);
+                });
+            }
+        }
+        return order;
+    }
+
+    // The nodes with the given labels, in that order, and the edges between them.
+    template<typename G>
+    G inducedSubgraph(G& graph, const vector<string>& labels) {
+        G subgraph;
+        graph.extractSubgraph(nodeIndices(graph, labels), subgraph);
+        return subgraph;
+    }
+
+    // The nodes at most `k` hops from `label` (its ego network), and the edges between them.
+    template<typename G>
+    G khop(G& graph, const string& label, int k) {
+        G subgraph;
+        graph.extractSubgraph(khopIndices(graph, label, k), subgraph);
+        return subgraph;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef UNION_FIND_HPP
+#define UNION_FIND_HPP
+
+#include <utility>
+#include <vector>
+
+#include "memory.hpp"
+
+using std::vector;
+
+namespace stella {
+    /*
+        Disjoint sets over the node indices 0 to size() - 1, with union by size and
+        path halving, so that any sequence of operations costs O(α(n)) each. `I` is
+        the index type: int for in-memory graphs, int64_t for mapped ones.
+    */
+    template<typename I>
+    class BasicUnionFind {
+        protected:
+            vector<I> parent;
+            vector<I> sizes;
+            size_t count = 0;
+        public:
+            BasicUnionFind(size_t size = 0) {
+                resize(size);
+            }
+            // Adds singleton sets up to `size`; never shrinks.
+            void resize(size_t size) {
+                for (size_t i = parent.size(); i < size; i++) {
+                    parent.push_back(i);
+                    sizes.push_back(1);
+                    count++;
+                }
+            }
+            I find(I item) {
+                while (parent[item] != item) {
+                    parent[item] = parent[parent[item]];
+                    item = parent[item];
+                }
+                return item;
+            }
+            // False if both were already in the same set.
+            bool unite(I first, I second) {
+                first = find(first);
+                second = find(second);
+                if (first == second) return false;
+                if (sizes[first] < sizes[second]) std::swap(first, second);
+                parent[second] = first;
+                sizes[first] += sizes[second];
+                count--;
+                return true;
+            }
+            size_t setCount() const {
+                return count;
+            }
+            size_t size() const {
+                return parent.size();
+            }
+            size_t heapBytes() const {
+                return vectorSize(parent) + vectorSize(sizes);
+            }
+    };
+
+    typedef BasicUnionFind<int> UnionFind;
+}
+
+#endif
\ No newline at end of file
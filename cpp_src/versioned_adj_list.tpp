@@ -0,0 +1,285 @@
+#ifndef VERSIONED_ADJ_LIST_TPP
+#define VERSIONED_ADJ_LIST_TPP
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "edge.hpp"
+#include "fingerprint.hpp"
+#include "node.hpp"
+
+using std::invalid_argument;
+using std::make_shared;
+using std::shared_ptr;
+using std::string;
+using std::uint64_t;
+using std::unordered_map;
+using std::vector;
+
+namespace stella {
+    /*
+        Copy-on-write support for the versioned graphs. Every piece of shared state
+        records the epoch of the version that created it: the writer changes it in
+        place while that version is unpublished, and replaces it with a copy once a
+        published version holds it, so published data is never modified.
+    */
+    template<typename T>
+    T& writableCopy(shared_ptr<T>& slot, uint64_t epoch) {
+        if (!slot) slot = make_shared<T>();
+        else if (slot->epoch == epoch) return *slot;
+        else slot = make_shared<T>(*slot);
+        slot->epoch = epoch;
+        return *slot;
+    }
+
+    // Label index split into buckets of about BUCKET_LOAD entries, so that a write
+    // copies one bucket rather than the whole index.
+    template<typename V>
+    class VersionedIndex {
+        protected:
+            struct Bucket {
+                uint64_t epoch = 0;
+                unordered_map<string, V> entries;
+            };
+            static const size_t BUCKET_LOAD = 128;
+            vector<shared_ptr<Bucket>> buckets;
+            size_t count = 0;
+
+            size_t bucketOf(const string& key) const {
+                return labelFingerprint(key) & (buckets.size() - 1);
+            }
+            void grow(uint64_t epoch) {
+                vector<shared_ptr<Bucket>> old(buckets.size() * 2);
+                old.swap(buckets);
+                for (const shared_ptr<Bucket>& bucket : old) {
+                    if (!bucket) continue;
+                    for (const auto& pair : bucket->entries)
+                        writableCopy(buckets[bucketOf(pair.first)], epoch).entries.insert(pair);
+                }
+            }
+        public:
+            VersionedIndex() : buckets(1) {}
+            const V* find(const string& key) const {
+                const shared_ptr<Bucket>& bucket = buckets[bucketOf(key)];
+                if (!bucket) return nullptr;
+                auto it = bucket->entries.find(key);
+                return it == bucket->entries.end() ? nullptr : &it->second;
+            }
+            // False, leaving the index as it was, if the key is already there.
+            bool insert(const string& key, const V& value, uint64_t epoch) {
+                shared_ptr<Bucket>& bucket = buckets[bucketOf(key)];
+                if (bucket && bucket->entries.count(key)) return false;
+                writableCopy(bucket, epoch).entries.emplace(key, value);
+                if (++count > buckets.size() * BUCKET_LOAD) grow(epoch);
+                return true;
+            }
+            size_t size() const {
+                return count;
+            }
+            template<typename F>
+            void forEach(F visit) const {
+                for (const shared_ptr<Bucket>& bucket : buckets) {
+                    if (!bucket) continue;
+                    for (const auto& pair : bucket->entries) visit(pair.second);
+                }
+            }
+    };
+
+    template<typename N, typename E> class VersionedAdjList;
+
+    /*
+        One immutable state of a VersionedAdjList. Nodes live in chunks of CHUNK_SIZE,
+        each node with its own incidence list, and both node and edge labels are
+        indexed by VersionedIndex; all of these are shared with the versions before
+        and after this one until the writer changes them.
+    */
+    template<typename N, typename E>
+    class AdjListVersion {
+        friend class VersionedAdjList<N, E>;
+        protected:
+            static const unsigned CHUNK_BITS = 6;
+            static const size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+            struct Incidence {
+                uint64_t epoch = 0;
+                vector<shared_ptr<E>> edges;
+            };
+            struct NodeChunk {
+                uint64_t epoch = 0;
+                shared_ptr<N> nodes[CHUNK_SIZE];
+                shared_ptr<Incidence> incidence[CHUNK_SIZE];
+            };
+
+            uint64_t epoch = 0;
+            uint64_t fingerprint = 0;
+            size_t nodeCount = 0;
+            vector<shared_ptr<NodeChunk>> chunks;
+            VersionedIndex<int> nodeIndex;
+            VersionedIndex<shared_ptr<E>> edges;
+
+            const NodeChunk& chunkOf(size_t index) const {
+                return *chunks[index >> CHUNK_BITS];
+            }
+        public:
+            // Published versions are numbered from 1; 0 is the empty graph.
+            uint64_t getEpoch() const {
+                return epoch;
+            }
+            uint64_t getFingerprint() const {
+                return fingerprint;
+            }
+            size_t getNodeCount() const {
+                return nodeCount;
+            }
+            size_t getEdgeCount() const {
+                return edges.size();
+            }
+            int getNodeIndex(const string& label) const {
+                const int* index = nodeIndex.find(label);
+                return index ? *index : -1;
+            }
+            shared_ptr<N> getNode(const string& label) const {
+                const int* index = nodeIndex.find(label);
+                if (!index) return nullptr;
+                return chunkOf(*index).nodes[*index & (CHUNK_SIZE - 1)];
+            }
+            // Nodes are in insertion order, so an index from getNodeIndex is valid here.
+            shared_ptr<N> getNode(size_t index) const {
+                return chunkOf(index).nodes[index & (CHUNK_SIZE - 1)];
+            }
+            shared_ptr<E> getEdge(const string& label) const {
+                const shared_ptr<E>* edge = edges.find(label);
+                return edge ? *edge : nullptr;
+            }
+            // Calls `visit(node)` for every node, in insertion order.
+            template<typename F>
+            void forEachNode(F visit) const {
+                for (size_t i = 0; i < nodeCount; i++) visit(getNode(i));
+            }
+            // Calls `visit(edge)` once for every edge, in no particular order.
+            template<typename F>
+            void forEachEdge(F visit) const {
+                edges.forEach(visit);
+            }
+            // Calls `visit(edge)` once for every edge touching the node.
+            template<typename F>
+            void forEachIncidentEdge(const string& label, F visit) const {
+                const int* index = nodeIndex.find(label);
+                if (!index) return;
+                const shared_ptr<Incidence>& incidence = chunkOf(*index).incidence[*index & (CHUNK_SIZE - 1)];
+                if (!incidence) return;
+                for (const shared_ptr<E>& edge : incidence->edges) visit(edge);
+            }
+    };
+
+    /*
+        AdjList with snapshots for concurrent readers. One writer thread calls
+        addNode/addEdge and `publish()`es its changes now and then; any thread may take
+        a `snapshot()` at any time, which is a handle to the last published version.
+
+        Readers never wait for the writer: a snapshot is immutable and stays valid for
+        as long as it is held, whatever the writer does meanwhile. Publishing costs a
+        copy of the chunk and bucket tables, and after it the first write to a chunk,
+        incidence list or index bucket copies that piece only; everything untouched is
+        shared between versions. A version is freed when the writer and the last snapshot
+        holding it let go of it.
+    */
+    template<typename N, typename E>
+    class VersionedAdjList {
+        static_assert(is_edge<E>::value, "E must be of type stella::BasicEdge for non-directed graphs");
+        public:
+            using NodeType = N;
+            using EdgeType = E;
+            using Weight = typename E::Weight;
+            typedef AdjListVersion<N, E> Version;
+            typedef shared_ptr<const Version> Snapshot;
+        protected:
+            typedef typename Version::NodeChunk NodeChunk;
+            typedef typename Version::Incidence Incidence;
+
+            Version working;
+            // Only accessed through std::atomic_load and std::atomic_store.
+            Snapshot current;
+
+            void link(const shared_ptr<E>& edge, size_t node) {
+                NodeChunk& chunk = writableCopy(working.chunks[node >> Version::CHUNK_BITS], working.epoch);
+                writableCopy(chunk.incidence[node & (Version::CHUNK_SIZE - 1)], working.epoch).edges.push_back(edge);
+            }
+            void insertEdge(const shared_ptr<E>& edge, int n1, int n2) {
+                if (!working.edges.insert(edge->getLabel(), edge, working.epoch))
+                    throw invalid_argument("Edge already exists: " + edge->getLabel());
+                link(edge, n1);
+                if (n2 != n1) link(edge, n2);
+                working.fingerprint += edgeFingerprint(*edge);
+            }
+        public:
+            VersionedAdjList() : current(make_shared<Version>()) {
+                working.epoch = 1;
+            }
+            VersionedAdjList(const VersionedAdjList&) = delete;
+            VersionedAdjList& operator=(const VersionedAdjList&) = delete;
+
+            void addNode(shared_ptr<N> node) {
+                size_t index = working.nodeCount;
+                if (!working.nodeIndex.insert(node->getLabel(), index, working.epoch))
+                    throw invalid_argument("Node already exists: " + node->getLabel());
+                if ((index >> Version::CHUNK_BITS) == working.chunks.size()) working.chunks.emplace_back();
+                NodeChunk& chunk = writableCopy(working.chunks[index >> Version::CHUNK_BITS], working.epoch);
+                chunk.nodes[index & (Version::CHUNK_SIZE - 1)] = node;
+                working.nodeCount++;
+                working.fingerprint += nodeFingerprint(node->getLabel());
+            }
+            void addNode(string label) {
+                if (working.nodeIndex.find(label))
+                    throw invalid_argument("Node already exists: " + label);
+                addNode(make_shared<N>(label));
+            }
+            void addEdge(shared_ptr<E> edge) {
+                int n1 = working.getNodeIndex(edge->getN1()->getLabel());
+                int n2 = working.getNodeIndex(edge->getN2()->getLabel());
+                if (n1 < 0 || n2 < 0)
+                    throw invalid_argument("Node labels not found: "
+                        + edge->getN1()->getLabel() + " " + edge->getN2()->getLabel());
+                insertEdge(edge, n1, n2);
+            }
+            void addEdge(string label, string n1, string n2) {
+                addEdge(label, n1, n2, Weight(1));
+            }
+            void addEdge(string label, string n1, string n2, Weight weight) {
+                if (working.edges.find(label))
+                    throw invalid_argument("Edge already exists: " + label);
+                int node1 = working.getNodeIndex(n1);
+                int node2 = working.getNodeIndex(n2);
+                if (node1 < 0 || node2 < 0)
+                    throw invalid_argument("Node labels not found: " + n1 + " " + n2);
+                insertEdge(make_shared<E>(label, working.getNode(node1), working.getNode(node2), weight), node1, node2);
+            }
+
+            // Makes everything written so far visible to new snapshots.
+            void publish() {
+                std::atomic_store(&current, Snapshot(make_shared<Version>(working)));
+                working.epoch++;
+            }
+            // Safe to call from any thread.
+            Snapshot snapshot() const {
+                return std::atomic_load(&current);
+            }
+            // The writer's own view, including unpublished changes. Writer thread only.
+            const Version& getWorkingVersion() const {
+                return working;
+            }
+    };
+
+    template<typename N, typename E>
+    class DirectedVersionedAdjList: public VersionedAdjList<N, E> {
+        static_assert(is_directed<E>::value, "E must be of type stella::BasicDirectedEdge for directed graphs");
+        public:
+            DirectedVersionedAdjList(): VersionedAdjList<N, E>() {}
+    };
+}
+
+#endif
\ No newline at end of file
@@ -1,222 +1,244 @@
 #include "adj_list.hpp"
+#include "adj_matrix.hpp"
 
 PyObject *AdjList_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
     AdjListObject *self;
     self = (AdjListObject *)type->tp_alloc(type, 0);
     if (self != NULL) {
         self->adjlist = nullptr;
+        self->busy = false;
+        self->wrappers = new WrapperCache();
     }
     return (PyObject *)self;
 }
 
 int AdjList_init(AdjListObject *self, PyObject *args, PyObject *kwds) {
-    self->adjlist = make_unique<stella::AdjList<stella::Node, stella::Edge>>();
+    GRAPH_ENSURE_IDLE(self, -1);
+    PyObject* source = NULL;
+    if (!PyArg_ParseTuple(args, "|O", &source)) return -1;
+    if (source == NULL) {
+        self->adjlist = make_unique<stella::AdjList<stella::Node, stella::Edge>>();
+        return 0;
+    }
+    if (!PyObject_TypeCheck(source, &AdjMatrixType) || PyObject_TypeCheck(source, &DirectedAdjMatrixType)) {
+        PyErr_SetString(PyExc_TypeError, "Graph must be of AdjMatrix type");
+        return -1;
+    }
+    AdjMatrixObject* other = (AdjMatrixObject*) source;
+    GRAPH_ENSURE_IDLE(other, -1);
+    try {
+        self->adjlist = make_unique<stella::AdjList<stella::Node, stella::Edge>>(*other->adjmatrix);
+    } catch (std::invalid_argument& ex) {
+        PyErr_SetString(PyExc_RuntimeError, ex.what());
+        return -1;
+    }
     return 0;
 }
 
 void AdjList_dealloc(AdjListObject* self) {
+    delete self->wrappers;
     Py_TYPE(self)->tp_free((PyObject *) self);
 }
 
-PyObject* AdjList_addNode(AdjListObject* self, PyObject* args) {
-    PyObject* arg;
-    if (PyArg_ParseTuple(args, "s", &arg)) {
-        try {
-            ((AdjListObject*) (self))->adjlist->addNode(make_shared<stella::Node>((const char* )arg));
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
+PyObject* AdjList_addNode(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_addNode(*self->adjlist, *self->wrappers, args, nargs);
+}
 
-    PyErr_Clear();
-
-    if (PyArg_ParseTuple(args, "O", &arg)) {
-        if (!PyObject_IsInstance(arg, (PyObject* )&NodeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of Node type");
-            return NULL;
-        }
-        NodeObject* nodeObj = (NodeObject*) arg;
-        shared_ptr<stella::Node>* node = nodeObj->node;
-        nodeObj->isOwner = false;
-        try {
-            ((AdjListObject*) (self))->adjlist->addNode(*node);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    } else {
-        PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_node, expected Node object or str");
-        return NULL;
-    }
+PyObject* AdjList_addEdge(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_addEdge<stella::Edge>(*self->adjlist, *self->wrappers, args, nargs);
 }
 
-PyObject* AdjList_addEdge(AdjListObject* self, PyObject* args) {
-    PyObject* arg;
-    const char* label;
-    const char* n1_label;
-    const char* n2_label;
-    int weight = 1;
+PyObject* AdjList_getEdge(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_getEdge(*self->adjlist, *self->wrappers, args, nargs);
+}
 
+PyObject* AdjList_getNode(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_getNode(*self->adjlist, *self->wrappers, args, nargs);
+}
 
-    if (PyArg_ParseTuple(args, "sss|i", &label, &n1_label, &n2_label, &weight)) {
-        try {
-            ((AdjListObject *) (self))->adjlist->addEdge(label, n1_label, n2_label, weight);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
+PyObject* AdjList_removeNode(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeNode(*self->adjlist, *self->wrappers, args, nargs);
+}
 
-    PyErr_Clear();
-
-    if (PyArg_ParseTuple(args, "O", &arg)) {
-        if (PyObject_IsInstance(arg, (PyObject* )&DirectedEdgeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of non-directed Edge type");
-            return NULL;
-        }
-        if (!PyObject_IsInstance(arg, (PyObject* )&EdgeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of Edge type");
-            return NULL;
-        }
-
-        EdgeObject* edgeObject = (EdgeObject*) arg;
-        try {
-            ((AdjListObject*) (self))->adjlist->addEdge(*(edgeObject->edge));
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
+PyObject* AdjList_removeEdge(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeEdge(*self->adjlist, *self->wrappers, args, nargs);
+}
 
-    PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_edge. Expected Edge object or (str, str, str, [int]).");
-    return NULL;
+PyObject* AdjList_getAllNodes(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return View_create(&NodeViewType, (PyObject*) self,
+        new ListSource<stella::AdjList<stella::Node, stella::Edge>>(&self->adjlist, &self->busy, self->wrappers));
 }
 
-PyObject* AdjList_getEdge(AdjListObject* self, PyObject* args) {
-    const char* label;
-    if (!PyArg_ParseTuple(args, "s", &label)) {
-        PyErr_SetString(PyExc_ValueError, "No argument for get_edge, str expected");
-        return NULL;
-    }
+PyObject* AdjList_getAllEdges(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return View_create(&EdgeViewType, (PyObject*) self,
+        new ListSource<stella::AdjList<stella::Node, stella::Edge>>(&self->adjlist, &self->busy, self->wrappers));
+}
 
-    shared_ptr<stella::Edge> edge = self->adjlist->getEdge(label);
-    if (edge) {
-        EdgeObject* pyEdge = PyObject_New(EdgeObject, &EdgeType);
-        if (!pyEdge)
-            PyErr_NoMemory();
-        pyEdge->edge = new shared_ptr<stella::Edge>(edge);
-        return (PyObject *) pyEdge;
-    }
+PyGetSetDef AdjList_GetSetDef[] = {
+    {"edges", (getter)AdjList_getAllEdges, NULL, "Node label", NULL},
+    {"nodes", (getter)AdjList_getAllNodes, NULL, "Node label", NULL},
+    {NULL}
+};
 
-    Py_RETURN_NONE;
+
+PyObject* AdjList_addNodes(AdjListObject* self, PyObject* args) {
+    return Graph_addNodes(*self->adjlist, self->busy, args);
 }
 
-PyObject* AdjList_getNode(AdjListObject* self, PyObject* args) {
-    const char* label;
-    if (!PyArg_ParseTuple(args, "s", &label)) {
-        PyErr_SetString(PyExc_ValueError, "No argument for get_node, str expected");
-        return NULL;
-    }
+PyObject* AdjList_addEdges(AdjListObject* self, PyObject* args) {
+    return Graph_addEdges(*self->adjlist, self->busy, args);
+}
 
-    shared_ptr<stella::Node> node = self->adjlist->getNode(label);
-    if (node) {
+PyObject* AdjList_generateErdosRenyi(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateErdosRenyi(*self->adjlist, self->busy, args, kwds);
+}
 
-        NodeObject* node_obj = PyObject_New(NodeObject, &NodeType);
-        if (!node_obj) {
-            return PyErr_NoMemory();
-        }
-        node_obj->node = new shared_ptr<stella::Node>(node);
+PyObject* AdjList_generateRMAT(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateRMAT(*self->adjlist, self->busy, args, kwds);
+}
 
-        return (PyObject*)node_obj;
-    }
+PyObject* AdjList_generateBarabasiAlbert(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateBarabasiAlbert(*self->adjlist, self->busy, args, kwds);
+}
 
-    Py_RETURN_NONE;
+PyObject* AdjList_generateGrid(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateGrid(*self->adjlist, self->busy, args, kwds);
 }
 
-PyObject* AdjList_getAllNodes(AdjListObject* self, PyObject* args) {
+PyObject* AdjList_edgeArrays(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_edgeArrays(*self->adjlist);
+}
 
-    std::vector<shared_ptr<stella::Node>>& nodes = ((AdjListObject*) (self))->adjlist->getAllNodes();
+PyObject* AdjList_csr(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_csr(*self->adjlist);
+}
 
-    PyObject* pyNodes = PyList_New(0);
-    if (!pyNodes) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to create Python list");
-        return NULL;
-    }
+PyObject* AdjList_toDense(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_toDense(*self->adjlist);
+}
 
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        NodeObject* pyNode = PyObject_New(NodeObject, &NodeType);
-        if (!pyNode) {
-            return PyErr_NoMemory();
-        }
-        pyNode->node = new shared_ptr<stella::Node>(nodes[i]);
-        if (!pyNode) {
-            Py_DECREF(pyNodes);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to build Python value");
-            return NULL;
-        }
-        PyList_Append(pyNodes, (PyObject *)pyNode);
-    }
-    return pyNodes;
+PyObject* AdjList_bfs(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_bfs(*self->adjlist, self->busy, args, kwds);
 }
 
-PyObject* AdjList_getAllEdges(AdjListObject* self, PyObject* args) {
-    std::map<std::string, shared_ptr<stella::Edge>>& edges = self->adjlist->getAllEdges();
-    PyObject* pyEdges = PyDict_New();
-    if (!pyEdges) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to create Python dictionary");
-        return NULL;
-    }
+PyObject* AdjList_shortestPaths(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_shortestPaths(*self->adjlist, self->busy, args, kwds);
+}
 
-    for (const auto& pair : edges) {
-        PyObject* key = PyUnicode_FromString(pair.first.c_str());
-        if (!key) {
-            Py_DECREF(pyEdges);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to convert C++ key to Python string");
-            return NULL;
-        }
-
-        EdgeObject* value = PyObject_New(EdgeObject, &EdgeType);
-        if (!value) {
-            Py_DECREF(key);
-            Py_DECREF(pyEdges);
-            PyErr_NoMemory();
-            return NULL;
-        }
-
-        value->edge = new shared_ptr<stella::Edge>(pair.second);
-
-        if (PyDict_SetItem(pyEdges, key, (PyObject *)value) < 0) {
-            Py_DECREF(key);
-            Py_DECREF(value);
-            Py_DECREF(pyEdges);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to add item to Python dictionary");
-            return NULL;
-        }
-
-        Py_DECREF(key);
-        Py_DECREF(value);
-    }
+PyObject* AdjList_components(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_components(*self->adjlist, self->busy, args, kwds);
+}
 
-    return pyEdges;
+PyObject* AdjList_pageRank(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_pageRank(*self->adjlist, self->busy, args, kwds);
 }
 
-PyGetSetDef AdjList_GetSetDef[] = {
-    {"edges", (getter)AdjList_getAllEdges, NULL, "Node label", NULL},
-    {"nodes", (getter)AdjList_getAllNodes, NULL, "Node label", NULL},
-    {NULL}
-};
+PyObject* AdjList_reorder(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_reorder(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* AdjList_khop(AdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_khop(self, &AdjListObject::adjlist, args, kwds);
+}
+
+PyObject* AdjList_inducedSubgraph(AdjListObject* self, PyObject* args) {
+    return Graph_inducedSubgraph(self, &AdjListObject::adjlist, args);
+}
+
+PyObject* AdjList_stats(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_stats(*self->adjlist);
+}
+
+PyObject* AdjList_resetStats(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_resetStats(*self->adjlist);
+}
+
+PyObject* AdjList_memoryUsage(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_memoryUsage(*self->adjlist);
+}
+
+PyObject* AdjList_fingerprint(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjlist->getFingerprint());
+}
+
+PyObject* AdjList_epoch(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjlist->getEpoch());
+}
+
+PyObject* AdjList_connected(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_connected(*self->adjlist, args, nargs);
+}
+
+PyObject* AdjList_componentOf(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_componentOf(*self->adjlist, args, nargs);
+}
+
+PyObject* AdjList_incidentEdges(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_incidentEdges(*self->adjlist, *self->wrappers, args, nargs);
+}
+
+PyObject* AdjList_neighbors(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_neighbors(*self->adjlist, *self->wrappers, args, nargs);
+}
 
+PyObject* AdjList_componentCount(AdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromSize_t(self->adjlist->componentCount());
+}
 
 PyMethodDef AdjList_methods[] = {
-    {"add_node", (PyCFunction)AdjList_addNode, METH_VARARGS, "Add a node to the graph."},
-    {"add_edge", (PyCFunction)AdjList_addEdge, METH_VARARGS, "Add an edge to the graph."},
-    {"get_edge", (PyCFunction)AdjList_getEdge, METH_VARARGS, "Get an edge from the graph."},
-    {"get_node", (PyCFunction)AdjList_getNode, METH_VARARGS, "Get a node from the graph."},
+    {"add_node", (PyCFunction)(void(*)(void))AdjList_addNode, METH_FASTCALL, "Add a node to the graph."},
+    {"add_edge", (PyCFunction)(void(*)(void))AdjList_addEdge, METH_FASTCALL, "Add an edge to the graph."},
+    {"get_edge", (PyCFunction)(void(*)(void))AdjList_getEdge, METH_FASTCALL, "Get an edge from the graph."},
+    {"get_node", (PyCFunction)(void(*)(void))AdjList_getNode, METH_FASTCALL, "Get a node from the graph."},
+    {"remove_node", (PyCFunction)(void(*)(void))AdjList_removeNode, METH_FASTCALL, "Remove a node and its edges from the graph."},
+    {"remove_edge", (PyCFunction)(void(*)(void))AdjList_removeEdge, METH_FASTCALL, "Remove an edge from the graph."},
+    {"add_nodes", (PyCFunction)AdjList_addNodes, METH_VARARGS, "Add many nodes to the graph, releasing the GIL."},
+    {"add_edges", (PyCFunction)AdjList_addEdges, METH_VARARGS, "Add many edges to the graph, releasing the GIL."},
+    {"generate_erdos_renyi", (PyCFunction)(void(*)(void))AdjList_generateErdosRenyi, METH_VARARGS | METH_KEYWORDS, "Add an Erdos-Renyi G(n, p) random graph, releasing the GIL."},
+    {"generate_rmat", (PyCFunction)(void(*)(void))AdjList_generateRMAT, METH_VARARGS | METH_KEYWORDS, "Add an R-MAT (Kronecker) random graph, releasing the GIL."},
+    {"generate_barabasi_albert", (PyCFunction)(void(*)(void))AdjList_generateBarabasiAlbert, METH_VARARGS | METH_KEYWORDS, "Add a Barabasi-Albert preferential attachment graph, releasing the GIL."},
+    {"generate_grid", (PyCFunction)(void(*)(void))AdjList_generateGrid, METH_VARARGS | METH_KEYWORDS, "Add a 2D grid graph, optionally with links dropped at random, releasing the GIL."},
+    {"edge_arrays", (PyCFunction)AdjList_edgeArrays, METH_NOARGS, "Get (sources, targets, weights) arrays of node indices."},
+    {"csr", (PyCFunction)AdjList_csr, METH_NOARGS, "Get (offsets, targets, weights) CSR adjacency arrays."},
+    {"to_dense", (PyCFunction)AdjList_toDense, METH_NOARGS, "Get the dense V x V weight matrix."},
+    {"bfs", (PyCFunction)(void(*)(void))AdjList_bfs, METH_VARARGS | METH_KEYWORDS, "Get the BFS hop distance from a source node to every node, releasing the GIL."},
+    {"shortest_paths", (PyCFunction)(void(*)(void))AdjList_shortestPaths, METH_VARARGS | METH_KEYWORDS, "Get Dijkstra (distances, predecessors) from one or more source nodes, releasing the GIL."},
+    {"components", (PyCFunction)(void(*)(void))AdjList_components, METH_VARARGS | METH_KEYWORDS, "Get the connected component number of every node, releasing the GIL."},
+    {"pagerank", (PyCFunction)(void(*)(void))AdjList_pageRank, METH_VARARGS | METH_KEYWORDS, "Get the PageRank of every node, releasing the GIL."},
+    {"reorder", (PyCFunction)(void(*)(void))AdjList_reorder, METH_VARARGS | METH_KEYWORDS, "Renumber the nodes for locality, releasing the GIL."},
+    {"khop", (PyCFunction)(void(*)(void))AdjList_khop, METH_VARARGS | METH_KEYWORDS, "Get the subgraph of the nodes at most k hops from a node, releasing the GIL."},
+    {"induced_subgraph", (PyCFunction)AdjList_inducedSubgraph, METH_VARARGS, "Get the subgraph of the given nodes and the edges between them, releasing the GIL."},
+    {"stats", (PyCFunction)AdjList_stats, METH_NOARGS, "Get the operation counters and latency histograms, or None if not compiled in."},
+    {"reset_stats", (PyCFunction)AdjList_resetStats, METH_NOARGS, "Reset the operation counters and latency histograms."},
+    {"memory_usage", (PyCFunction)AdjList_memoryUsage, METH_NOARGS, "Get the bytes held by the graph, by category."},
+    {"fingerprint", (PyCFunction)AdjList_fingerprint, METH_NOARGS, "Get the 64-bit structural fingerprint of the graph."},
+    {"epoch", (PyCFunction)AdjList_epoch, METH_NOARGS, "Get the mutation counter of the graph."},
+    {"connected", (PyCFunction)(void(*)(void))AdjList_connected, METH_FASTCALL, "Check whether two nodes are in the same connected component."},
+    {"component_of", (PyCFunction)(void(*)(void))AdjList_componentOf, METH_FASTCALL, "Get the index of the node standing for a node's connected component."},
+    {"incident_edges", (PyCFunction)(void(*)(void))AdjList_incidentEdges, METH_FASTCALL, "Get the edges touching a node."},
+    {"neighbors", (PyCFunction)(void(*)(void))AdjList_neighbors, METH_FASTCALL, "Get the nodes at the other end of the edges leaving a node."},
+    {"component_count", (PyCFunction)AdjList_componentCount, METH_NOARGS, "Get the number of connected components."},
     {NULL, NULL, 0, NULL}
 };
 
@@ -225,8 +247,11 @@ PyObject *AdjList_richcompare(PyObject *first, PyObject *second, int op) {
     || !PyObject_IsInstance(second, (PyObject *)&AdjListType))
         Py_RETURN_NOTIMPLEMENTED;
 
-    auto adjList1 = *(((AdjListObject *)first)->adjlist);
-    auto adjList2 = *(((AdjListObject *)second)->adjlist);
+    GRAPH_ENSURE_IDLE((AdjListObject *)first, NULL);
+    GRAPH_ENSURE_IDLE((AdjListObject *)second, NULL);
+
+    auto& adjList1 = *(((AdjListObject *)first)->adjlist);
+    auto& adjList2 = *(((AdjListObject *)second)->adjlist);
 
     bool result = false;
     switch (op) {
@@ -289,120 +314,210 @@ PyObject *DirectedAdjList_new(PyTypeObject *type, PyObject *args, PyObject *kwds
     self = (DirectedAdjListObject *)type->tp_alloc(type, 0);
     if (self != NULL) {
         self->adjlist = nullptr;
+        self->busy = false;
+        self->wrappers = new WrapperCache();
     }
     return (PyObject *)self;
 }
 
 
 int DirectedAdjList_init(DirectedAdjListObject *self, PyObject *args, PyObject *kwds) {
-    self->adjlist = make_unique<stella::DirectedAdjList<stella::Node, stella::DirectedEdge>>();
+    GRAPH_ENSURE_IDLE(self, -1);
+    PyObject* source = NULL;
+    if (!PyArg_ParseTuple(args, "|O", &source)) return -1;
+    if (source == NULL) {
+        self->adjlist = make_unique<stella::DirectedAdjList<stella::Node, stella::DirectedEdge>>();
+        return 0;
+    }
+    if (!PyObject_TypeCheck(source, &DirectedAdjMatrixType)) {
+        PyErr_SetString(PyExc_TypeError, "Graph must be of DirectedAdjMatrix type");
+        return -1;
+    }
+    DirectedAdjMatrixObject* other = (DirectedAdjMatrixObject*) source;
+    GRAPH_ENSURE_IDLE(other, -1);
+    try {
+        self->adjlist = make_unique<stella::DirectedAdjList<stella::Node, stella::DirectedEdge>>(*other->adjmatrix);
+    } catch (std::invalid_argument& ex) {
+        PyErr_SetString(PyExc_RuntimeError, ex.what());
+        return -1;
+    }
     return 0;
 };
 
-PyObject* DirectedAdjList_addEdge(DirectedAdjListObject* self, PyObject* args) {
-    PyObject* arg;
-    const char* label;
-    const char* n1_label;
-    const char* n2_label;
-    int weight = 1;
-
-
-    if (PyArg_ParseTuple(args, "sss|i", &label, &n1_label, &n2_label, &weight)) {
-        try {
-            ((DirectedAdjListObject*) (self))->adjlist->addEdge(label, n1_label, n2_label, weight);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
+PyObject* DirectedAdjList_addEdge(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_addEdge<stella::DirectedEdge>(*self->adjlist, *self->wrappers, args, nargs);
+}
 
-    PyErr_Clear();
-
-    if (PyArg_ParseTuple(args, "O", &arg)) {
-        if (!PyObject_IsInstance(arg, (PyObject* )&DirectedEdgeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of DirectedEdge type");
-            return NULL;
-        }
-
-        DirectedEdgeObject* edgeObject = (DirectedEdgeObject*) arg;
-        shared_ptr<stella::DirectedEdge>* edge = edgeObject->edge;
-        try {
-            ((DirectedAdjListObject*) (self))->adjlist->addEdge(*edge);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
+PyObject* DirectedAdjList_removeNode(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeNode(*self->adjlist, *self->wrappers, args, nargs);
+}
 
-    PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_edge. Expected Edge object or (str, str, str, [int]).");
-    return NULL;
+PyObject* DirectedAdjList_removeEdge(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeEdge(*self->adjlist, *self->wrappers, args, nargs);
 }
 
-PyObject* DirectedAdjList_getEdge(DirectedAdjListObject* self, PyObject* args) {
-    const char* label;
-    if (!PyArg_ParseTuple(args, "s", &label)) {
-        PyErr_SetString(PyExc_ValueError, "No argument for get_edge, str expected");
-        return NULL;
-    }
+PyObject* DirectedAdjList_getEdge(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_getEdge(*self->adjlist, *self->wrappers, args, nargs);
+}
 
-    shared_ptr<stella::DirectedEdge>* edge = new shared_ptr<stella::DirectedEdge>(self->adjlist->getEdge(label));
-    if (edge) {
-        DirectedEdgeObject* pyEdge = PyObject_New(DirectedEdgeObject, &DirectedEdgeType);
-        if (!pyEdge)
-            PyErr_NoMemory();
-        pyEdge->edge = edge;
-        return (PyObject *) pyEdge;
-    }
+PyObject* DirectedAdjList_getAllEdges(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return View_create(&EdgeViewType, (PyObject*) self,
+        new ListSource<stella::DirectedAdjList<stella::Node, stella::DirectedEdge>>(&self->adjlist, &self->busy, self->wrappers));
+}
 
-    Py_RETURN_NONE;
+PyObject* DirectedAdjList_addNodes(DirectedAdjListObject* self, PyObject* args) {
+    return Graph_addNodes(*self->adjlist, self->busy, args);
 }
 
-PyObject* DirectedAdjList_getAllEdges(DirectedAdjListObject* self, PyObject* args) {
-    std::map<std::string, shared_ptr<stella::DirectedEdge>>& edges = self->adjlist->getAllEdges();
-    PyObject* pyEdges = PyDict_New();
-    if (!pyEdges) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to create Python dictionary");
-        return NULL;
-    }
+PyObject* DirectedAdjList_addEdges(DirectedAdjListObject* self, PyObject* args) {
+    return Graph_addEdges(*self->adjlist, self->busy, args);
+}
 
-    for (const auto& pair : edges) {
-        PyObject* key = PyUnicode_FromString(pair.first.c_str());
-        if (!key) {
-            Py_DECREF(pyEdges);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to convert C++ key to Python string");
-            return NULL;
-        }
-
-        DirectedEdgeObject* value = PyObject_New(DirectedEdgeObject, &DirectedEdgeType);
-        if (!value) {
-            Py_DECREF(key);
-            Py_DECREF(pyEdges);
-            PyErr_NoMemory();
-            return NULL;
-        }
-
-        value->edge = new shared_ptr<stella::DirectedEdge>(pair.second);
-
-        if (PyDict_SetItem(pyEdges, key, (PyObject *)value) < 0) {
-            Py_DECREF(key);
-            Py_DECREF(value);
-            Py_DECREF(pyEdges);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to add item to Python dictionary");
-            return NULL;
-        }
-
-        Py_DECREF(key);
-        Py_DECREF(value);
-    }
+PyObject* DirectedAdjList_generateErdosRenyi(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateErdosRenyi(*self->adjlist, self->busy, args, kwds);
+}
 
-    return pyEdges;
-};
+PyObject* DirectedAdjList_generateRMAT(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateRMAT(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_generateBarabasiAlbert(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateBarabasiAlbert(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_generateGrid(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateGrid(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_edgeArrays(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_edgeArrays(*self->adjlist);
+}
+
+PyObject* DirectedAdjList_csr(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_csr(*self->adjlist);
+}
+
+PyObject* DirectedAdjList_toDense(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_toDense(*self->adjlist);
+}
+
+PyObject* DirectedAdjList_bfs(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_bfs(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_shortestPaths(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_shortestPaths(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_components(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_components(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_pageRank(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_pageRank(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_reorder(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_reorder(*self->adjlist, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjList_khop(DirectedAdjListObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_khop(self, &DirectedAdjListObject::adjlist, args, kwds);
+}
+
+PyObject* DirectedAdjList_inducedSubgraph(DirectedAdjListObject* self, PyObject* args) {
+    return Graph_inducedSubgraph(self, &DirectedAdjListObject::adjlist, args);
+}
+
+PyObject* DirectedAdjList_stats(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_stats(*self->adjlist);
+}
+
+PyObject* DirectedAdjList_resetStats(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_resetStats(*self->adjlist);
+}
+
+PyObject* DirectedAdjList_memoryUsage(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_memoryUsage(*self->adjlist);
+}
+
+PyObject* DirectedAdjList_fingerprint(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjlist->getFingerprint());
+}
+
+PyObject* DirectedAdjList_epoch(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjlist->getEpoch());
+}
+
+PyObject* DirectedAdjList_connected(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_connected(*self->adjlist, args, nargs);
+}
+
+PyObject* DirectedAdjList_componentOf(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_componentOf(*self->adjlist, args, nargs);
+}
+
+PyObject* DirectedAdjList_incidentEdges(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_incidentEdges(*self->adjlist, *self->wrappers, args, nargs);
+}
+
+PyObject* DirectedAdjList_neighbors(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_neighbors(*self->adjlist, *self->wrappers, args, nargs);
+}
+
+PyObject* DirectedAdjList_componentCount(DirectedAdjListObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromSize_t(self->adjlist->componentCount());
+}
 
 PyMethodDef DirectedAdjList_methods[] = {
-    {"add_edge", (PyCFunction)DirectedAdjList_addEdge, METH_VARARGS, "Add an edge to the graph."},
-    {"get_edge", (PyCFunction)DirectedAdjList_getEdge, METH_VARARGS, "Get an edge from the graph."},
+    {"add_edge", (PyCFunction)(void(*)(void))DirectedAdjList_addEdge, METH_FASTCALL, "Add an edge to the graph."},
+    {"remove_node", (PyCFunction)(void(*)(void))DirectedAdjList_removeNode, METH_FASTCALL, "Remove a node and its edges from the graph."},
+    {"remove_edge", (PyCFunction)(void(*)(void))DirectedAdjList_removeEdge, METH_FASTCALL, "Remove an edge from the graph."},
+    {"get_edge", (PyCFunction)(void(*)(void))DirectedAdjList_getEdge, METH_FASTCALL, "Get an edge from the graph."},
+    {"add_nodes", (PyCFunction)DirectedAdjList_addNodes, METH_VARARGS, "Add many nodes to the graph, releasing the GIL."},
+    {"add_edges", (PyCFunction)DirectedAdjList_addEdges, METH_VARARGS, "Add many edges to the graph, releasing the GIL."},
+    {"generate_erdos_renyi", (PyCFunction)(void(*)(void))DirectedAdjList_generateErdosRenyi, METH_VARARGS | METH_KEYWORDS, "Add an Erdos-Renyi G(n, p) random graph, releasing the GIL."},
+    {"generate_rmat", (PyCFunction)(void(*)(void))DirectedAdjList_generateRMAT, METH_VARARGS | METH_KEYWORDS, "Add an R-MAT (Kronecker) random graph, releasing the GIL."},
+    {"generate_barabasi_albert", (PyCFunction)(void(*)(void))DirectedAdjList_generateBarabasiAlbert, METH_VARARGS | METH_KEYWORDS, "Add a Barabasi-Albert preferential attachment graph, releasing the GIL."},
+    {"generate_grid", (PyCFunction)(void(*)(void))DirectedAdjList_generateGrid, METH_VARARGS | METH_KEYWORDS, "Add a 2D grid graph, optionally with links dropped at random, releasing the GIL."},
+    {"edge_arrays", (PyCFunction)DirectedAdjList_edgeArrays, METH_NOARGS, "Get (sources, targets, weights) arrays of node indices."},
+    {"csr", (PyCFunction)DirectedAdjList_csr, METH_NOARGS, "Get (offsets, targets, weights) CSR adjacency arrays."},
+    {"to_dense", (PyCFunction)DirectedAdjList_toDense, METH_NOARGS, "Get the dense V x V weight matrix."},
+    {"bfs", (PyCFunction)(void(*)(void))DirectedAdjList_bfs, METH_VARARGS | METH_KEYWORDS, "Get the BFS hop distance from a source node to every node, releasing the GIL."},
+    {"shortest_paths", (PyCFunction)(void(*)(void))DirectedAdjList_shortestPaths, METH_VARARGS | METH_KEYWORDS, "Get Dijkstra (distances, predecessors) from one or more source nodes, releasing the GIL."},
+    {"components", (PyCFunction)(void(*)(void))DirectedAdjList_components, METH_VARARGS | METH_KEYWORDS, "Get the connected component number of every node, releasing the GIL."},
+    {"pagerank", (PyCFunction)(void(*)(void))DirectedAdjList_pageRank, METH_VARARGS | METH_KEYWORDS, "Get the PageRank of every node, releasing the GIL."},
+    {"reorder", (PyCFunction)(void(*)(void))DirectedAdjList_reorder, METH_VARARGS | METH_KEYWORDS, "Renumber the nodes for locality, releasing the GIL."},
+    {"khop", (PyCFunction)(void(*)(void))DirectedAdjList_khop, METH_VARARGS | METH_KEYWORDS, "Get the subgraph of the nodes at most k hops from a node, releasing the GIL."},
+    {"induced_subgraph", (PyCFunction)DirectedAdjList_inducedSubgraph, METH_VARARGS, "Get the subgraph of the given nodes and the edges between them, releasing the GIL."},
+    {"stats", (PyCFunction)DirectedAdjList_stats, METH_NOARGS, "Get the operation counters and latency histograms, or None if not compiled in."},
+    {"reset_stats", (PyCFunction)DirectedAdjList_resetStats, METH_NOARGS, "Reset the operation counters and latency histograms."},
+    {"memory_usage", (PyCFunction)DirectedAdjList_memoryUsage, METH_NOARGS, "Get the bytes held by the graph, by category."},
+    {"fingerprint", (PyCFunction)DirectedAdjList_fingerprint, METH_NOARGS, "Get the 64-bit structural fingerprint of the graph."},
+    {"epoch", (PyCFunction)DirectedAdjList_epoch, METH_NOARGS, "Get the mutation counter of the graph."},
+    {"connected", (PyCFunction)(void(*)(void))DirectedAdjList_connected, METH_FASTCALL, "Check whether two nodes are in the same connected component."},
+    {"component_of", (PyCFunction)(void(*)(void))DirectedAdjList_componentOf, METH_FASTCALL, "Get the index of the node standing for a node's connected component."},
+    {"incident_edges", (PyCFunction)(void(*)(void))DirectedAdjList_incidentEdges, METH_FASTCALL, "Get the edges touching a node."},
+    {"neighbors", (PyCFunction)(void(*)(void))DirectedAdjList_neighbors, METH_FASTCALL, "Get the nodes at the other end of the edges leaving a node."},
+    {"component_count", (PyCFunction)DirectedAdjList_componentCount, METH_NOARGS, "Get the number of connected components."},
     {NULL, NULL}
 };
 
@@ -416,8 +531,11 @@ PyObject *DirectedAdjList_richcompare(PyObject *first, PyObject *second, int op)
     || !PyObject_IsInstance(second, (PyObject *)&DirectedAdjListType))
         Py_RETURN_NOTIMPLEMENTED;
 
-    auto adjList1 = *(((DirectedAdjListObject *)first)->adjlist);
-    auto adjList2 = *(((DirectedAdjListObject *)second)->adjlist);
+    GRAPH_ENSURE_IDLE((DirectedAdjListObject *)first, NULL);
+    GRAPH_ENSURE_IDLE((DirectedAdjListObject *)second, NULL);
+
+    auto& adjList1 = *(((DirectedAdjListObject *)first)->adjlist);
+    auto& adjList2 = *(((DirectedAdjListObject *)second)->adjlist);
 
     bool result = false;
     switch (op) {
@@ -8,6 +8,13 @@
 
 #include "graph.hpp"
 #include "edge.hpp"
+#include "array.hpp"
+#include "bulk.hpp"
+#include "algorithms.hpp"
+#include "memory.hpp"
+#include "stats.hpp"
+#include "views.hpp"
+#include "wrappers.hpp"
 
 using std::make_unique;
 using std::unique_ptr;
@@ -15,6 +22,8 @@ using std::unique_ptr;
 typedef struct {
     PyObject_HEAD
     unique_ptr<stella::AdjList<stella::Node, stella::Edge>> adjlist;
+    bool busy;
+    WrapperCache* wrappers;
 } AdjListObject;
 
 PyObject *AdjList_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
@@ -23,13 +32,17 @@ int AdjList_init(AdjListObject *self, PyObject *args, PyObject *kwds);
 
 void AdjList_dealloc(AdjListObject* self);
 
-PyObject* AdjList_addNode(AdjListObject* self, PyObject* args);
+PyObject* AdjList_addNode(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
 
-PyObject* AdjList_addEdge(AdjListObject* self, PyObject* args);
+PyObject* AdjList_addEdge(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
 
-PyObject* AdjList_getEdge(AdjListObject* self, PyObject* args);
+PyObject* AdjList_getEdge(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
 
-PyObject* AdjList_getNode(AdjListObject* self, PyObject* args);
+PyObject* AdjList_getNode(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjList_removeNode(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjList_removeEdge(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
 
 PyObject* AdjList_getAllNodes(AdjListObject* self, PyObject* args);
 
@@ -37,25 +50,125 @@ PyObject* AdjList_getAllEdges(AdjListObject* self, PyObject* args);
 
 PyObject* AdjList_richcompare(PyObject* first, PyObject* second, int op);
 
+PyObject* AdjList_addNodes(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_addEdges(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_generateErdosRenyi(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_generateRMAT(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_generateBarabasiAlbert(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_generateGrid(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_edgeArrays(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_csr(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_toDense(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_bfs(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_shortestPaths(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_components(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_pageRank(AdjListObject* self, PyObject* args, PyObject* kwds);
+PyObject* AdjList_reorder(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_khop(AdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjList_inducedSubgraph(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_stats(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_resetStats(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_memoryUsage(AdjListObject* self, PyObject* args);
+
+PyObject* AdjList_fingerprint(AdjListObject* self, PyObject* args);
+PyObject* AdjList_epoch(AdjListObject* self, PyObject* args);
+PyObject* AdjList_connected(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* AdjList_componentOf(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjList_incidentEdges(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjList_neighbors(AdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* AdjList_componentCount(AdjListObject* self, PyObject* args);
+
 extern PyTypeObject AdjListType;
 
 typedef struct {
     PyObject_HEAD
     unique_ptr<stella::DirectedAdjList<stella::Node, stella::DirectedEdge>> adjlist;
+    bool busy;
+    WrapperCache* wrappers;
 } DirectedAdjListObject;
 
 PyObject *DirectedAdjList_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
 
 int DirectedAdjList_init(DirectedAdjListObject *self, PyObject *args, PyObject *kwds);
 
-PyObject* DirectedAdjList_addEdge(DirectedAdjListObject* self, PyObject* args);
+PyObject* DirectedAdjList_addEdge(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
 
-PyObject* DirectedAdjList_getEdge(DirectedAdjListObject* self, PyObject* args);
+PyObject* DirectedAdjList_removeNode(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjList_removeEdge(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjList_getEdge(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
 
 PyObject* DirectedAdjList_getAllEdges(DirectedAdjListObject* self, PyObject* args);;
 
 PyObject* DirectedAdjList_richcompare(PyObject* first, PyObject* second, int op);
 
+PyObject* DirectedAdjList_addNodes(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_addEdges(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_generateErdosRenyi(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_generateRMAT(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_generateBarabasiAlbert(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_generateGrid(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_edgeArrays(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_csr(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_toDense(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_bfs(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_shortestPaths(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_components(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_pageRank(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+PyObject* DirectedAdjList_reorder(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_khop(DirectedAdjListObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjList_inducedSubgraph(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_stats(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_resetStats(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_memoryUsage(DirectedAdjListObject* self, PyObject* args);
+
+PyObject* DirectedAdjList_fingerprint(DirectedAdjListObject* self, PyObject* args);
+PyObject* DirectedAdjList_epoch(DirectedAdjListObject* self, PyObject* args);
+PyObject* DirectedAdjList_connected(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* DirectedAdjList_componentOf(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjList_incidentEdges(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjList_neighbors(DirectedAdjListObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* DirectedAdjList_componentCount(DirectedAdjListObject* self, PyObject* args);
+
 extern PyTypeObject DirectedAdjListType;
 
 #endif
\ No newline at end of file
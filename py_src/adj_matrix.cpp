@@ -1,227 +1,80 @@
 #include "adj_matrix.hpp"
+#include "adj_list.hpp"
 
 PyObject *AdjMatrix_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
     AdjMatrixObject *self;
     self = (AdjMatrixObject *)type->tp_alloc(type, 0);
     if (self != NULL) {
-        self->adjmatrix= nullptr;
+        self->adjmatrix = nullptr;
+        self->busy = false;
+        self->wrappers = new WrapperCache();
     }
     return (PyObject *)self;
 }
 
 int AdjMatrix_init(AdjMatrixObject *self, PyObject *args, PyObject *kwds) {
-    self->adjmatrix = make_unique<stella::AdjMatrix<stella::Node, stella::Edge>>();
+    GRAPH_ENSURE_IDLE(self, -1);
+    PyObject* source = NULL;
+    if (!PyArg_ParseTuple(args, "|O", &source)) return -1;
+    if (source == NULL) {
+        self->adjmatrix = make_unique<stella::AdjMatrix<stella::Node, stella::Edge>>();
+        return 0;
+    }
+    if (!PyObject_TypeCheck(source, &AdjListType) || PyObject_TypeCheck(source, &DirectedAdjListType)) {
+        PyErr_SetString(PyExc_TypeError, "Graph must be of AdjList type");
+        return -1;
+    }
+    AdjListObject* other = (AdjListObject*) source;
+    GRAPH_ENSURE_IDLE(other, -1);
+    try {
+        self->adjmatrix = make_unique<stella::AdjMatrix<stella::Node, stella::Edge>>(*other->adjlist);
+    } catch (std::invalid_argument& ex) {
+        PyErr_SetString(PyExc_RuntimeError, ex.what());
+        return -1;
+    }
     return 0;
 }
 
 void AdjMatrix_dealloc(AdjMatrixObject* self) {
+    delete self->wrappers;
     Py_TYPE(self)->tp_free((PyObject *) self);
 }
 
-PyObject* AdjMatrix_addNode(AdjMatrixObject* self, PyObject* args) {
-    PyObject* arg;
-    if (PyArg_ParseTuple(args, "s", &arg)) {
-        try {
-            self->adjmatrix->addNode(make_shared<stella::Node>((const char* )arg));
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
-
-    PyErr_Clear();
-
-    if (PyArg_ParseTuple(args, "O", &arg)) {
-        if (!PyObject_IsInstance(arg, (PyObject* )&NodeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of Node type");
-            return NULL;
-        }
-        NodeObject* nodeObj = (NodeObject*) arg;
-        shared_ptr<stella::Node>* node = nodeObj->node;
-        nodeObj->isOwner = false;
-        try {
-            self->adjmatrix->addNode(*node);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    } else {
-        PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_node, expected Node object or str");
-        return NULL;
-    }
+PyObject* AdjMatrix_addNode(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_addNode(*self->adjmatrix, *self->wrappers, args, nargs);
 }
 
-PyObject* AdjMatrix_addEdge(AdjMatrixObject* self, PyObject* args) {
-    PyObject* arg;
-    const char* label;
-    const char* n1_label;
-    const char* n2_label;
-    int weight = 1;
-
-
-    if (PyArg_ParseTuple(args, "sss|i", &label, &n1_label, &n2_label, &weight)) {
-        try {
-            self->adjmatrix->addEdge(label, n1_label, n2_label, weight);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
-
-    PyErr_Clear();
-
-    if (PyArg_ParseTuple(args, "O", &arg)) {
-        if (PyObject_IsInstance(arg, (PyObject* )&DirectedEdgeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of non-directed Edge type");
-            return NULL;
-        }
-        if (!PyObject_IsInstance(arg, (PyObject* )&EdgeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of Edge type");
-            return NULL;
-        }
-
-        EdgeObject* edgeObject = (EdgeObject*) arg;
-        shared_ptr<stella::Edge>* edge = edgeObject->edge;
-        try {
-            self->adjmatrix->addEdge(*edge);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
-
-    PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_edge. Expected Edge object or (str, str, str, [int]).");
-    return NULL;
+PyObject* AdjMatrix_addEdge(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_addEdge<stella::Edge>(*self->adjmatrix, *self->wrappers, args, nargs);
 }
 
-PyObject* AdjMatrix_getNode(AdjMatrixObject* self, PyObject* args) {
-    const char* label;
-    if (!PyArg_ParseTuple(args, "s", &label)) {
-        PyErr_SetString(PyExc_ValueError, "No argument for get_node, str expected");
-        return NULL;
-    }
-
-    shared_ptr<stella::Node> node = self->adjmatrix->getNode(label);
-    if (node) {
-
-        NodeObject* node_obj = PyObject_New(NodeObject, &NodeType);
-        if (!node_obj) {
-            return PyErr_NoMemory();
-        }
-        node_obj->node = new shared_ptr<stella::Node>(node);
+PyObject* AdjMatrix_getNode(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_getNode(*self->adjmatrix, *self->wrappers, args, nargs);
+}
 
-        return (PyObject*)node_obj;
-    }
+PyObject* AdjMatrix_removeNode(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeNode(*self->adjmatrix, *self->wrappers, args, nargs);
+}
 
-    Py_RETURN_NONE;
+PyObject* AdjMatrix_removeEdge(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeEdge(*self->adjmatrix, *self->wrappers, args, nargs);
 }
 
 PyObject* AdjMatrix_getAllNodes(AdjMatrixObject* self, PyObject* args) {
-
-    std::vector<shared_ptr<stella::Node>>& nodes = self->adjmatrix->getAllNodes();
-
-    PyObject* pyNodes = PyList_New(0);
-    if (!pyNodes) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to create Python list");
-        return NULL;
-    }
-
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        NodeObject* pyNode = PyObject_New(NodeObject, &NodeType);
-        if (!pyNode) {
-            return PyErr_NoMemory();
-        }
-        pyNode->node = new shared_ptr<stella::Node>(nodes[i]);
-        pyNode->isOwner = false;
-        if (!pyNode) {
-            Py_DECREF(pyNodes);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to build Python value");
-            return NULL;
-        }
-        PyList_Append(pyNodes, (PyObject *)pyNode);
-    }
-    return pyNodes;
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return View_create(&NodeViewType, (PyObject*) self,
+        new MatrixSource<stella::AdjMatrix<stella::Node, stella::Edge>>(&self->adjmatrix, &self->busy, self->wrappers));
 }
 
 PyObject* AdjMatrix_getAllEdges(AdjMatrixObject* self, PyObject* args) {
-    auto& edges = self->adjmatrix->getAllEdges();
-
-    PyObject* pyEdges = PyList_New(edges.size());
-    if (!pyEdges) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to create Python list");
-        return NULL;
-    }
-
-    // Iterate over each pair in edges
-    for (size_t i = 0; i < edges.size(); ++i) {
-        PyObject* innerList = PyList_New(edges[i].size());
-        if (!innerList) {
-            Py_DECREF(pyEdges);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to create inner Python list");
-            return NULL;
-        }
-
-        // Iterate over each map<string, Edge*> in edges[i]
-        size_t j = 0;
-        for (const auto& edgeMap : edges[i]) {
-            PyObject* pyDict = PyDict_New();
-            if (!pyDict) {
-                Py_DECREF(innerList);
-                Py_DECREF(pyEdges);
-                PyErr_SetString(PyExc_RuntimeError, "Failed to create Python dictionary");
-                return NULL;
-            }
-
-            // Populate the dictionary with string keys and Edge objects
-            for (const auto& pair : edgeMap) {
-                PyObject* key = PyUnicode_FromString(pair.first.c_str());
-                if (!key) {
-                    Py_DECREF(pyDict);
-                    Py_DECREF(innerList);
-                    Py_DECREF(pyEdges);
-                    PyErr_SetString(PyExc_RuntimeError, "Failed to convert C++ key to Python string");
-                    return NULL;
-                }
-
-                EdgeObject* value = PyObject_New(EdgeObject, &EdgeType);
-                if (!value) {
-                    Py_DECREF(key);
-                    Py_DECREF(pyDict);
-                    Py_DECREF(innerList);
-                    Py_DECREF(pyEdges);
-                    PyErr_NoMemory();
-                    return NULL;
-                }
-
-                value->edge = new shared_ptr<stella::Edge>(pair.second);
-
-                if (PyDict_SetItem(pyDict, key, (PyObject*)value) < 0) {
-                    Py_DECREF(key);
-                    Py_DECREF(value);
-                    Py_DECREF(pyDict);
-                    Py_DECREF(innerList);
-                    Py_DECREF(pyEdges);
-                    PyErr_SetString(PyExc_RuntimeError, "Failed to add item to Python dictionary");
-                    return NULL;
-                }
-
-                Py_DECREF(key);
-                Py_DECREF(value);
-            }
-
-            // Add the dictionary to the inner list
-            PyList_SET_ITEM(innerList, j++, pyDict); // Steals reference to pyDict
-        }
-
-        // Add the inner list to the main list
-        PyList_SET_ITEM(pyEdges, i, innerList); // Steals reference to innerList
-    }
-
-    return pyEdges;
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return View_create(&MatrixViewType, (PyObject*) self,
+        new MatrixSource<stella::AdjMatrix<stella::Node, stella::Edge>>(&self->adjmatrix, &self->busy, self->wrappers));
 }
 
 PyObject* AdjMatrix_richcompare(PyObject* first, PyObject* second, int op) {
@@ -229,8 +82,11 @@ PyObject* AdjMatrix_richcompare(PyObject* first, PyObject* second, int op) {
     || !PyObject_IsInstance(second, (PyObject *)&AdjMatrixType))
         Py_RETURN_NOTIMPLEMENTED;
 
-    auto adjMatrix1 = *(((AdjMatrixObject *)first)->adjmatrix);
-    auto adjMatrix2 = *(((AdjMatrixObject *)second)->adjmatrix);
+    GRAPH_ENSURE_IDLE((AdjMatrixObject *)first, NULL);
+    GRAPH_ENSURE_IDLE((AdjMatrixObject *)second, NULL);
+
+    auto& adjMatrix1 = *(((AdjMatrixObject *)first)->adjmatrix);
+    auto& adjMatrix2 = *(((AdjMatrixObject *)second)->adjmatrix);
 
     bool result = false;
     switch (op) {
@@ -254,10 +110,155 @@ PyGetSetDef AdjMatrix_GetSetDef[] = {
 };
 
 
+PyObject* AdjMatrix_addNodes(AdjMatrixObject* self, PyObject* args) {
+    return Graph_addNodes(*self->adjmatrix, self->busy, args);
+}
+
+PyObject* AdjMatrix_addEdges(AdjMatrixObject* self, PyObject* args) {
+    return Graph_addEdges(*self->adjmatrix, self->busy, args);
+}
+
+PyObject* AdjMatrix_generateErdosRenyi(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateErdosRenyi(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_generateRMAT(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateRMAT(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_generateBarabasiAlbert(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateBarabasiAlbert(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_generateGrid(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateGrid(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_edgeArrays(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_edgeArrays(*self->adjmatrix);
+}
+
+PyObject* AdjMatrix_csr(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_csr(*self->adjmatrix);
+}
+
+PyObject* AdjMatrix_toDense(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_toDense(*self->adjmatrix);
+}
+
+PyObject* AdjMatrix_bfs(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_bfs(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_shortestPaths(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_shortestPaths(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_components(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_components(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_pageRank(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_pageRank(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_reorder(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_reorder(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* AdjMatrix_khop(AdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_khop(self, &AdjMatrixObject::adjmatrix, args, kwds);
+}
+
+PyObject* AdjMatrix_inducedSubgraph(AdjMatrixObject* self, PyObject* args) {
+    return Graph_inducedSubgraph(self, &AdjMatrixObject::adjmatrix, args);
+}
+
+PyObject* AdjMatrix_stats(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_stats(*self->adjmatrix);
+}
+
+PyObject* AdjMatrix_resetStats(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_resetStats(*self->adjmatrix);
+}
+
+PyObject* AdjMatrix_memoryUsage(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_memoryUsage(*self->adjmatrix);
+}
+
+PyObject* AdjMatrix_fingerprint(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjmatrix->getFingerprint());
+}
+
+PyObject* AdjMatrix_epoch(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjmatrix->getEpoch());
+}
+
+PyObject* AdjMatrix_connected(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_connected(*self->adjmatrix, args, nargs);
+}
+
+PyObject* AdjMatrix_componentOf(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_componentOf(*self->adjmatrix, args, nargs);
+}
+
+PyObject* AdjMatrix_incidentEdges(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_incidentEdges(*self->adjmatrix, *self->wrappers, args, nargs);
+}
+
+PyObject* AdjMatrix_neighbors(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_neighbors(*self->adjmatrix, *self->wrappers, args, nargs);
+}
+
+PyObject* AdjMatrix_componentCount(AdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromSize_t(self->adjmatrix->componentCount());
+}
+
 PyMethodDef AdjMatrix_methods[] = {
-    {"add_node", (PyCFunction)AdjMatrix_addNode, METH_VARARGS, "Add a node to the graph."},
-    {"add_edge", (PyCFunction)AdjMatrix_addEdge, METH_VARARGS, "Add an edge to the graph."},
-    {"get_node", (PyCFunction)AdjMatrix_getNode, METH_VARARGS, "Get a node from the graph."},
+    {"add_node", (PyCFunction)(void(*)(void))AdjMatrix_addNode, METH_FASTCALL, "Add a node to the graph."},
+    {"add_edge", (PyCFunction)(void(*)(void))AdjMatrix_addEdge, METH_FASTCALL, "Add an edge to the graph."},
+    {"get_node", (PyCFunction)(void(*)(void))AdjMatrix_getNode, METH_FASTCALL, "Get a node from the graph."},
+    {"remove_node", (PyCFunction)(void(*)(void))AdjMatrix_removeNode, METH_FASTCALL, "Remove a node and its edges from the graph."},
+    {"remove_edge", (PyCFunction)(void(*)(void))AdjMatrix_removeEdge, METH_FASTCALL, "Remove an edge from the graph."},
+    {"add_nodes", (PyCFunction)AdjMatrix_addNodes, METH_VARARGS, "Add many nodes to the graph, releasing the GIL."},
+    {"add_edges", (PyCFunction)AdjMatrix_addEdges, METH_VARARGS, "Add many edges to the graph, releasing the GIL."},
+    {"generate_erdos_renyi", (PyCFunction)(void(*)(void))AdjMatrix_generateErdosRenyi, METH_VARARGS | METH_KEYWORDS, "Add an Erdos-Renyi G(n, p) random graph, releasing the GIL."},
+    {"generate_rmat", (PyCFunction)(void(*)(void))AdjMatrix_generateRMAT, METH_VARARGS | METH_KEYWORDS, "Add an R-MAT (Kronecker) random graph, releasing the GIL."},
+    {"generate_barabasi_albert", (PyCFunction)(void(*)(void))AdjMatrix_generateBarabasiAlbert, METH_VARARGS | METH_KEYWORDS, "Add a Barabasi-Albert preferential attachment graph, releasing the GIL."},
+    {"generate_grid", (PyCFunction)(void(*)(void))AdjMatrix_generateGrid, METH_VARARGS | METH_KEYWORDS, "Add a 2D grid graph, optionally with links dropped at random, releasing the GIL."},
+    {"edge_arrays", (PyCFunction)AdjMatrix_edgeArrays, METH_NOARGS, "Get (sources, targets, weights) arrays of node indices."},
+    {"csr", (PyCFunction)AdjMatrix_csr, METH_NOARGS, "Get (offsets, targets, weights) CSR adjacency arrays."},
+    {"to_dense", (PyCFunction)AdjMatrix_toDense, METH_NOARGS, "Get the dense V x V weight matrix."},
+    {"bfs", (PyCFunction)(void(*)(void))AdjMatrix_bfs, METH_VARARGS | METH_KEYWORDS, "Get the BFS hop distance from a source node to every node, releasing the GIL."},
+    {"shortest_paths", (PyCFunction)(void(*)(void))AdjMatrix_shortestPaths, METH_VARARGS | METH_KEYWORDS, "Get Dijkstra (distances, predecessors) from one or more source nodes, releasing the GIL."},
+    {"components", (PyCFunction)(void(*)(void))AdjMatrix_components, METH_VARARGS | METH_KEYWORDS, "Get the connected component number of every node, releasing the GIL."},
+    {"pagerank", (PyCFunction)(void(*)(void))AdjMatrix_pageRank, METH_VARARGS | METH_KEYWORDS, "Get the PageRank of every node, releasing the GIL."},
+    {"reorder", (PyCFunction)(void(*)(void))AdjMatrix_reorder, METH_VARARGS | METH_KEYWORDS, "Renumber the nodes for locality, releasing the GIL."},
+    {"khop", (PyCFunction)(void(*)(void))AdjMatrix_khop, METH_VARARGS | METH_KEYWORDS, "Get the subgraph of the nodes at most k hops from a node, releasing the GIL."},
+    {"induced_subgraph", (PyCFunction)AdjMatrix_inducedSubgraph, METH_VARARGS, "Get the subgraph of the given nodes and the edges between them, releasing the GIL."},
+    {"stats", (PyCFunction)AdjMatrix_stats, METH_NOARGS, "Get the operation counters and latency histograms, or None if not compiled in."},
+    {"reset_stats", (PyCFunction)AdjMatrix_resetStats, METH_NOARGS, "Reset the operation counters and latency histograms."},
+    {"memory_usage", (PyCFunction)AdjMatrix_memoryUsage, METH_NOARGS, "Get the bytes held by the graph, by category."},
+    {"fingerprint", (PyCFunction)AdjMatrix_fingerprint, METH_NOARGS, "Get the 64-bit structural fingerprint of the graph."},
+    {"epoch", (PyCFunction)AdjMatrix_epoch, METH_NOARGS, "Get the mutation counter of the graph."},
+    {"connected", (PyCFunction)(void(*)(void))AdjMatrix_connected, METH_FASTCALL, "Check whether two nodes are in the same connected component."},
+    {"component_of", (PyCFunction)(void(*)(void))AdjMatrix_componentOf, METH_FASTCALL, "Get the index of the node standing for a node's connected component."},
+    {"incident_edges", (PyCFunction)(void(*)(void))AdjMatrix_incidentEdges, METH_FASTCALL, "Get the edges touching a node."},
+    {"neighbors", (PyCFunction)(void(*)(void))AdjMatrix_neighbors, METH_FASTCALL, "Get the nodes at the other end of the edges leaving a node."},
+    {"component_count", (PyCFunction)AdjMatrix_componentCount, METH_NOARGS, "Get the number of connected components."},
     {NULL, NULL, 0, NULL}
 };
 
@@ -307,167 +308,60 @@ PyObject *DirectedAdjMatrix_new(PyTypeObject *type, PyObject *args, PyObject *kw
     self = (DirectedAdjMatrixObject *)type->tp_alloc(type, 0);
     if (self != NULL) {
         self->adjmatrix = nullptr;
+        self->busy = false;
+        self->wrappers = new WrapperCache();
     }
     return (PyObject *)self;
 }
 
 
 int DirectedAdjMatrix_init(DirectedAdjMatrixObject *self, PyObject *args, PyObject *kwds) {
-    self->adjmatrix =  make_shared<stella::DirectedAdjMatrix<stella::Node, stella::DirectedEdge>>();
+    GRAPH_ENSURE_IDLE(self, -1);
+    PyObject* source = NULL;
+    if (!PyArg_ParseTuple(args, "|O", &source)) return -1;
+    if (source == NULL) {
+        self->adjmatrix = make_unique<stella::DirectedAdjMatrix<stella::Node, stella::DirectedEdge>>();
+        return 0;
+    }
+    if (!PyObject_TypeCheck(source, &DirectedAdjListType)) {
+        PyErr_SetString(PyExc_TypeError, "Graph must be of DirectedAdjList type");
+        return -1;
+    }
+    DirectedAdjListObject* other = (DirectedAdjListObject*) source;
+    GRAPH_ENSURE_IDLE(other, -1);
+    try {
+        self->adjmatrix = make_unique<stella::DirectedAdjMatrix<stella::Node, stella::DirectedEdge>>(*other->adjlist);
+    } catch (std::invalid_argument& ex) {
+        PyErr_SetString(PyExc_RuntimeError, ex.what());
+        return -1;
+    }
     return 0;
 };
 
-PyObject* DirectedAdjMatrix_addNode(DirectedAdjMatrixObject* self, PyObject* args) {
-    PyObject* arg;
-    if (PyArg_ParseTuple(args, "s", &arg)) {
-        try {
-            self->adjmatrix->addNode(make_shared<stella::Node>((const char* )arg));
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
-
-    PyErr_Clear();
-
-    if (PyArg_ParseTuple(args, "O", &arg)) {
-        if (!PyObject_IsInstance(arg, (PyObject* )&NodeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of Node type");
-            return NULL;
-        }
-        NodeObject* nodeObj = (NodeObject*) arg;
-        shared_ptr<stella::Node>* node = nodeObj->node;
-        nodeObj->isOwner = false;
-        try {
-            self->adjmatrix->addNode(*node);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    } else {
-        PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_node, expected Node object or str");
-        return NULL;
-    }
+PyObject* DirectedAdjMatrix_addNode(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_addNode(*self->adjmatrix, *self->wrappers, args, nargs);
 }
 
-PyObject* DirectedAdjMatrix_addEdge(DirectedAdjMatrixObject* self, PyObject* args) {
-    PyObject* arg;
-    const char* label;
-    const char* n1_label;
-    const char* n2_label;
-    int weight = 1;
-
-
-    if (PyArg_ParseTuple(args, "sss|i", &label, &n1_label, &n2_label, &weight)) {
-        try {
-            self->adjmatrix->addEdge(label, n1_label, n2_label, weight);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
+PyObject* DirectedAdjMatrix_addEdge(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_addEdge<stella::DirectedEdge>(*self->adjmatrix, *self->wrappers, args, nargs);
+}
 
-    PyErr_Clear();
-
-    if (PyArg_ParseTuple(args, "O", &arg)) {
-        if (!PyObject_IsInstance(arg, (PyObject* )&DirectedEdgeType)) {
-            PyErr_SetString(PyExc_TypeError, "Object must be of DirectedEdge type");
-            return NULL;
-        }
-
-        DirectedEdgeObject* edgeObject = (DirectedEdgeObject*) arg;
-        shared_ptr<stella::DirectedEdge>* edge = edgeObject->edge;
-        try {
-            self->adjmatrix->addEdge(*edge);
-            Py_RETURN_NONE;
-        } catch (std::invalid_argument ex) {
-            PyErr_SetString(PyExc_RuntimeError, ex.what());
-            return NULL;
-        }
-    }
+PyObject* DirectedAdjMatrix_removeNode(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeNode(*self->adjmatrix, *self->wrappers, args, nargs);
+}
 
-    PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_edge. Expected Edge object or (str, str, str, [int]).");
-    return NULL;
+PyObject* DirectedAdjMatrix_removeEdge(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_removeEdge(*self->adjmatrix, *self->wrappers, args, nargs);
 }
 
 PyObject* DirectedAdjMatrix_getAllEdges(DirectedAdjMatrixObject* self, PyObject* args) {
-    auto& edges = self->adjmatrix->getAllEdges();
-
-    PyObject* pyEdges = PyList_New(edges.size());
-    if (!pyEdges) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to create Python list");
-        return NULL;
-    }
-
-    // Iterate over each pair in edges
-    for (size_t i = 0; i < edges.size(); ++i) {
-        PyObject* innerList = PyList_New(edges[i].size());
-        if (!innerList) {
-            Py_DECREF(pyEdges);
-            PyErr_SetString(PyExc_RuntimeError, "Failed to create inner Python list");
-            return NULL;
-        }
-
-        // Iterate over each map<string, Edge*> in edges[i]
-        size_t j = 0;
-        for (const auto& edgeMap : edges[i]) {
-            PyObject* pyDict = PyDict_New();
-            if (!pyDict) {
-                Py_DECREF(innerList);
-                Py_DECREF(pyEdges);
-                PyErr_SetString(PyExc_RuntimeError, "Failed to create Python dictionary");
-                return NULL;
-            }
-
-            // Populate the dictionary with string keys and Edge objects
-            for (const auto& pair : edgeMap) {
-                PyObject* key = PyUnicode_FromString(pair.first.c_str());
-                if (!key) {
-                    Py_DECREF(pyDict);
-                    Py_DECREF(innerList);
-                    Py_DECREF(pyEdges);
-                    PyErr_SetString(PyExc_RuntimeError, "Failed to convert C++ key to Python string");
-                    return NULL;
-                }
-
-                DirectedEdgeObject* value = PyObject_New(DirectedEdgeObject, &DirectedEdgeType);
-                if (!value) {
-                    Py_DECREF(key);
-                    Py_DECREF(pyDict);
-                    Py_DECREF(innerList);
-                    Py_DECREF(pyEdges);
-                    PyErr_NoMemory();
-                    return NULL;
-                }
-
-                value->edge = new shared_ptr<stella::DirectedEdge>(pair.second);
-
-                if (PyDict_SetItem(pyDict, key, (PyObject*)value) < 0) {
-                    Py_DECREF(key);
-                    Py_DECREF(value);
-                    Py_DECREF(pyDict);
-                    Py_DECREF(innerList);
-                    Py_DECREF(pyEdges);
-                    PyErr_SetString(PyExc_RuntimeError, "Failed to add item to Python dictionary");
-                    return NULL;
-                }
-
-                Py_DECREF(key);
-                Py_DECREF(value);
-            }
-
-            // Add the dictionary to the inner list
-            PyList_SET_ITEM(innerList, j++, pyDict); // Steals reference to pyDict
-        }
-
-        // Add the inner list to the main list
-        PyList_SET_ITEM(pyEdges, i, innerList); // Steals reference to innerList
-    }
-
-    return pyEdges;
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return View_create(&MatrixViewType, (PyObject*) self,
+        new MatrixSource<stella::DirectedAdjMatrix<stella::Node, stella::DirectedEdge>>(&self->adjmatrix, &self->busy, self->wrappers));
 }
 
 PyObject* DirectedAdjMatrix_richcompare(PyObject* first, PyObject* second, int op) {
@@ -475,8 +369,11 @@ PyObject* DirectedAdjMatrix_richcompare(PyObject* first, PyObject* second, int o
     || !PyObject_IsInstance(second, (PyObject *)&DirectedAdjMatrixType))
         Py_RETURN_NOTIMPLEMENTED;
 
-    auto adjMatrix1 = *(((DirectedAdjMatrixObject *)first)->adjmatrix);
-    auto adjMatrix2 = *(((DirectedAdjMatrixObject *)second)->adjmatrix);
+    GRAPH_ENSURE_IDLE((DirectedAdjMatrixObject *)first, NULL);
+    GRAPH_ENSURE_IDLE((DirectedAdjMatrixObject *)second, NULL);
+
+    auto& adjMatrix1 = *(((DirectedAdjMatrixObject *)first)->adjmatrix);
+    auto& adjMatrix2 = *(((DirectedAdjMatrixObject *)second)->adjmatrix);
 
     bool result = false;
     switch (op) {
@@ -498,9 +395,154 @@ PyGetSetDef DirectedAdjMatrix_GetSetDef[] = {
     {NULL, NULL}
 };
 
+PyObject* DirectedAdjMatrix_addNodes(DirectedAdjMatrixObject* self, PyObject* args) {
+    return Graph_addNodes(*self->adjmatrix, self->busy, args);
+}
+
+PyObject* DirectedAdjMatrix_addEdges(DirectedAdjMatrixObject* self, PyObject* args) {
+    return Graph_addEdges(*self->adjmatrix, self->busy, args);
+}
+
+PyObject* DirectedAdjMatrix_generateErdosRenyi(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateErdosRenyi(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_generateRMAT(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateRMAT(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_generateBarabasiAlbert(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateBarabasiAlbert(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_generateGrid(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_generateGrid(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_edgeArrays(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_edgeArrays(*self->adjmatrix);
+}
+
+PyObject* DirectedAdjMatrix_csr(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_csr(*self->adjmatrix);
+}
+
+PyObject* DirectedAdjMatrix_toDense(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_toDense(*self->adjmatrix);
+}
+
+PyObject* DirectedAdjMatrix_bfs(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_bfs(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_shortestPaths(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_shortestPaths(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_components(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_components(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_pageRank(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_pageRank(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_reorder(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_reorder(*self->adjmatrix, self->busy, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_khop(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds) {
+    return Graph_khop(self, &DirectedAdjMatrixObject::adjmatrix, args, kwds);
+}
+
+PyObject* DirectedAdjMatrix_inducedSubgraph(DirectedAdjMatrixObject* self, PyObject* args) {
+    return Graph_inducedSubgraph(self, &DirectedAdjMatrixObject::adjmatrix, args);
+}
+
+PyObject* DirectedAdjMatrix_stats(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_stats(*self->adjmatrix);
+}
+
+PyObject* DirectedAdjMatrix_resetStats(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_resetStats(*self->adjmatrix);
+}
+
+PyObject* DirectedAdjMatrix_memoryUsage(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Graph_memoryUsage(*self->adjmatrix);
+}
+
+PyObject* DirectedAdjMatrix_fingerprint(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjmatrix->getFingerprint());
+}
+
+PyObject* DirectedAdjMatrix_epoch(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromUnsignedLongLong(self->adjmatrix->getEpoch());
+}
+
+PyObject* DirectedAdjMatrix_connected(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_connected(*self->adjmatrix, args, nargs);
+}
+
+PyObject* DirectedAdjMatrix_componentOf(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_componentOf(*self->adjmatrix, args, nargs);
+}
+
+PyObject* DirectedAdjMatrix_incidentEdges(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_incidentEdges(*self->adjmatrix, *self->wrappers, args, nargs);
+}
+
+PyObject* DirectedAdjMatrix_neighbors(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return Fast_neighbors(*self->adjmatrix, *self->wrappers, args, nargs);
+}
+
+PyObject* DirectedAdjMatrix_componentCount(DirectedAdjMatrixObject* self, PyObject* args) {
+    GRAPH_ENSURE_IDLE(self, NULL);
+    return PyLong_FromSize_t(self->adjmatrix->componentCount());
+}
+
 PyMethodDef DirectedAdjMatrix_methods[] = {
-    {"add_node", (PyCFunction)DirectedAdjMatrix_addNode, METH_VARARGS, "Add a node to the graph."},
-    {"add_edge", (PyCFunction)DirectedAdjMatrix_addEdge, METH_VARARGS, "Add an edge to the graph."},
+    {"add_node", (PyCFunction)(void(*)(void))DirectedAdjMatrix_addNode, METH_FASTCALL, "Add a node to the graph."},
+    {"add_edge", (PyCFunction)(void(*)(void))DirectedAdjMatrix_addEdge, METH_FASTCALL, "Add an edge to the graph."},
+    {"remove_node", (PyCFunction)(void(*)(void))DirectedAdjMatrix_removeNode, METH_FASTCALL, "Remove a node and its edges from the graph."},
+    {"remove_edge", (PyCFunction)(void(*)(void))DirectedAdjMatrix_removeEdge, METH_FASTCALL, "Remove an edge from the graph."},
+    {"add_nodes", (PyCFunction)DirectedAdjMatrix_addNodes, METH_VARARGS, "Add many nodes to the graph, releasing the GIL."},
+    {"add_edges", (PyCFunction)DirectedAdjMatrix_addEdges, METH_VARARGS, "Add many edges to the graph, releasing the GIL."},
+    {"generate_erdos_renyi", (PyCFunction)(void(*)(void))DirectedAdjMatrix_generateErdosRenyi, METH_VARARGS | METH_KEYWORDS, "Add an Erdos-Renyi G(n, p) random graph, releasing the GIL."},
+    {"generate_rmat", (PyCFunction)(void(*)(void))DirectedAdjMatrix_generateRMAT, METH_VARARGS | METH_KEYWORDS, "Add an R-MAT (Kronecker) random graph, releasing the GIL."},
+    {"generate_barabasi_albert", (PyCFunction)(void(*)(void))DirectedAdjMatrix_generateBarabasiAlbert, METH_VARARGS | METH_KEYWORDS, "Add a Barabasi-Albert preferential attachment graph, releasing the GIL."},
+    {"generate_grid", (PyCFunction)(void(*)(void))DirectedAdjMatrix_generateGrid, METH_VARARGS | METH_KEYWORDS, "Add a 2D grid graph, optionally with links dropped at random, releasing the GIL."},
+    {"edge_arrays", (PyCFunction)DirectedAdjMatrix_edgeArrays, METH_NOARGS, "Get (sources, targets, weights) arrays of node indices."},
+    {"csr", (PyCFunction)DirectedAdjMatrix_csr, METH_NOARGS, "Get (offsets, targets, weights) CSR adjacency arrays."},
+    {"to_dense", (PyCFunction)DirectedAdjMatrix_toDense, METH_NOARGS, "Get the dense V x V weight matrix."},
+    {"bfs", (PyCFunction)(void(*)(void))DirectedAdjMatrix_bfs, METH_VARARGS | METH_KEYWORDS, "Get the BFS hop distance from a source node to every node, releasing the GIL."},
+    {"shortest_paths", (PyCFunction)(void(*)(void))DirectedAdjMatrix_shortestPaths, METH_VARARGS | METH_KEYWORDS, "Get Dijkstra (distances, predecessors) from one or more source nodes, releasing the GIL."},
+    {"components", (PyCFunction)(void(*)(void))DirectedAdjMatrix_components, METH_VARARGS | METH_KEYWORDS, "Get the connected component number of every node, releasing the GIL."},
+    {"pagerank", (PyCFunction)(void(*)(void))DirectedAdjMatrix_pageRank, METH_VARARGS | METH_KEYWORDS, "Get the PageRank of every node, releasing the GIL."},
+    {"reorder", (PyCFunction)(void(*)(void))DirectedAdjMatrix_reorder, METH_VARARGS | METH_KEYWORDS, "Renumber the nodes for locality, releasing the GIL."},
+    {"khop", (PyCFunction)(void(*)(void))DirectedAdjMatrix_khop, METH_VARARGS | METH_KEYWORDS, "Get the subgraph of the nodes at most k hops from a node, releasing the GIL."},
+    {"induced_subgraph", (PyCFunction)DirectedAdjMatrix_inducedSubgraph, METH_VARARGS, "Get the subgraph of the given nodes and the edges between them, releasing the GIL."},
+    {"stats", (PyCFunction)DirectedAdjMatrix_stats, METH_NOARGS, "Get the operation counters and latency histograms, or None if not compiled in."},
+    {"reset_stats", (PyCFunction)DirectedAdjMatrix_resetStats, METH_NOARGS, "Reset the operation counters and latency histograms."},
+    {"memory_usage", (PyCFunction)DirectedAdjMatrix_memoryUsage, METH_NOARGS, "Get the bytes held by the graph, by category."},
+    {"fingerprint", (PyCFunction)DirectedAdjMatrix_fingerprint, METH_NOARGS, "Get the 64-bit structural fingerprint of the graph."},
+    {"epoch", (PyCFunction)DirectedAdjMatrix_epoch, METH_NOARGS, "Get the mutation counter of the graph."},
+    {"connected", (PyCFunction)(void(*)(void))DirectedAdjMatrix_connected, METH_FASTCALL, "Check whether two nodes are in the same connected component."},
+    {"component_of", (PyCFunction)(void(*)(void))DirectedAdjMatrix_componentOf, METH_FASTCALL, "Get the index of the node standing for a node's connected component."},
+    {"incident_edges", (PyCFunction)(void(*)(void))DirectedAdjMatrix_incidentEdges, METH_FASTCALL, "Get the edges touching a node."},
+    {"neighbors", (PyCFunction)(void(*)(void))DirectedAdjMatrix_neighbors, METH_FASTCALL, "Get the nodes at the other end of the edges leaving a node."},
+    {"component_count", (PyCFunction)DirectedAdjMatrix_componentCount, METH_NOARGS, "Get the number of connected components."},
     {NULL, NULL}
 };
 
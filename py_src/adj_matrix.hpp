@@ -9,6 +9,13 @@
 
 #include "graph.hpp"
 #include "edge.hpp"
+#include "array.hpp"
+#include "bulk.hpp"
+#include "algorithms.hpp"
+#include "memory.hpp"
+#include "stats.hpp"
+#include "views.hpp"
+#include "wrappers.hpp"
 
 using std::make_unique;
 using std::unique_ptr;
@@ -16,6 +23,8 @@ using std::unique_ptr;
 typedef struct {
     PyObject_HEAD
     unique_ptr<stella::AdjMatrix<stella::Node, stella::Edge>> adjmatrix;
+    bool busy;
+    WrapperCache* wrappers;
 } AdjMatrixObject;
 
 PyObject *AdjMatrix_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
@@ -24,11 +33,15 @@ int AdjMatrix_init(AdjMatrixObject *self, PyObject *args, PyObject *kwds);
 
 void AdjMatrix_dealloc(AdjMatrixObject* self);
 
-PyObject* AdjMatrix_addNode(AdjMatrixObject* self, PyObject* args);
+PyObject* AdjMatrix_addNode(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
 
-PyObject* AdjMatrix_addEdge(AdjMatrixObject* self, PyObject* args);
+PyObject* AdjMatrix_addEdge(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
 
-PyObject* AdjMatrix_getNode(AdjMatrixObject* self, PyObject* args);
+PyObject* AdjMatrix_getNode(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjMatrix_removeNode(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjMatrix_removeEdge(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
 
 PyObject* AdjMatrix_getAllNodes(AdjMatrixObject* self, PyObject* args);
 
@@ -36,25 +49,125 @@ PyObject* AdjMatrix_getAllEdges(AdjMatrixObject* self, PyObject* args);
 
 PyObject* AdjMatrix_richcompare(PyObject* first, PyObject* second, int op);
 
+PyObject* AdjMatrix_addNodes(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_addEdges(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_generateErdosRenyi(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_generateRMAT(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_generateBarabasiAlbert(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_generateGrid(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_edgeArrays(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_csr(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_toDense(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_bfs(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_shortestPaths(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_components(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_pageRank(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+PyObject* AdjMatrix_reorder(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_khop(AdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* AdjMatrix_inducedSubgraph(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_stats(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_resetStats(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_memoryUsage(AdjMatrixObject* self, PyObject* args);
+
+PyObject* AdjMatrix_fingerprint(AdjMatrixObject* self, PyObject* args);
+PyObject* AdjMatrix_epoch(AdjMatrixObject* self, PyObject* args);
+PyObject* AdjMatrix_connected(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* AdjMatrix_componentOf(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjMatrix_incidentEdges(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* AdjMatrix_neighbors(AdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* AdjMatrix_componentCount(AdjMatrixObject* self, PyObject* args);
+
 extern PyTypeObject AdjMatrixType;
 
 typedef struct {
     PyObject_HEAD
-    shared_ptr<stella::DirectedAdjMatrix<stella::Node, stella::DirectedEdge>> adjmatrix;
+    unique_ptr<stella::DirectedAdjMatrix<stella::Node, stella::DirectedEdge>> adjmatrix;
+    bool busy;
+    WrapperCache* wrappers;
 } DirectedAdjMatrixObject;
 
 PyObject *DirectedAdjMatrix_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
 
 int DirectedAdjMatrix_init(DirectedAdjMatrixObject *self, PyObject *args, PyObject *kwds);
 
-PyObject* DirectedAdjMatrix_addNode(DirectedAdjMatrixObject* self, PyObject* args);
+PyObject* DirectedAdjMatrix_addNode(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
 
-PyObject* DirectedAdjMatrix_addEdge(DirectedAdjMatrixObject* self, PyObject* args);
+PyObject* DirectedAdjMatrix_addEdge(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjMatrix_removeNode(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjMatrix_removeEdge(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
 
 PyObject* DirectedAdjMatrix_getAllEdges(DirectedAdjMatrixObject* self, PyObject* args);
 
 PyObject* DirectedAdjMatrix_richcompare(PyObject* first, PyObject* second, int op);
 
+PyObject* DirectedAdjMatrix_addNodes(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_addEdges(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_generateErdosRenyi(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_generateRMAT(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_generateBarabasiAlbert(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_generateGrid(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_edgeArrays(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_csr(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_toDense(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_bfs(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_shortestPaths(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_components(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_pageRank(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+PyObject* DirectedAdjMatrix_reorder(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_khop(DirectedAdjMatrixObject* self, PyObject* args, PyObject* kwds);
+
+PyObject* DirectedAdjMatrix_inducedSubgraph(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_stats(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_resetStats(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_memoryUsage(DirectedAdjMatrixObject* self, PyObject* args);
+
+PyObject* DirectedAdjMatrix_fingerprint(DirectedAdjMatrixObject* self, PyObject* args);
+PyObject* DirectedAdjMatrix_epoch(DirectedAdjMatrixObject* self, PyObject* args);
+PyObject* DirectedAdjMatrix_connected(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* DirectedAdjMatrix_componentOf(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjMatrix_incidentEdges(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+
+PyObject* DirectedAdjMatrix_neighbors(DirectedAdjMatrixObject* self, PyObject* const* args, Py_ssize_t nargs);
+PyObject* DirectedAdjMatrix_componentCount(DirectedAdjMatrixObject* self, PyObject* args);
+
 extern PyTypeObject DirectedAdjMatrixType;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,291 @@
+#ifndef ALGORITHMS_PYTHON_HPP
+#define ALGORITHMS_PYTHON_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <Python.h>
+
+#include "../cpp_src/stella.hpp"
+
+#include "array.hpp"
+#include "bulk.hpp"
+
+/*
+    Graph algorithms for the graph types. Source labels are resolved to node
+    indices while holding the GIL; building the CSR adjacency and running the
+    algorithm then happen with the GIL released (see Graph_runUnlocked), spread
+    over `threads` threads. Results are returned as stella.Array buffers indexed
+    like `graph.nodes`.
+*/
+
+inline bool Algorithm_idle(bool busy) {
+    if (busy) PyErr_SetString(PyExc_RuntimeError, "Graph is busy with a bulk operation in another thread");
+    return !busy;
+}
+
+// `threads=0` uses every hardware thread.
+inline bool Algorithm_threads(int threads) {
+    if (threads < 0) PyErr_SetString(PyExc_ValueError, "threads must be 0 or more");
+    return threads >= 0;
+}
+
+// Resolves a str, or a sequence of str when `many` is not NULL, to node indices.
+template<typename G>
+bool Algorithm_sources(G& graph, PyObject* arg, std::vector<int64_t>& sources, bool* many) {
+    auto resolve = [&graph, &sources](PyObject* item) {
+        Py_ssize_t size;
+        const char* data = PyUnicode_Check(item) ? PyUnicode_AsUTF8AndSize(item, &size) : NULL;
+        if (!data) {
+            if (!PyErr_Occurred()) PyErr_SetString(PyExc_TypeError, "Source labels must be of str type");
+            return false;
+        }
+        std::string label(data, size);
+        int index = graph.getNodeIndex(label);
+        if (index < 0) {
+            PyErr_SetString(PyExc_RuntimeError, ("Node labels not found: " + label).c_str());
+            return false;
+        }
+        sources.push_back(index);
+        return true;
+    };
+
+    if (!many || PyUnicode_Check(arg)) {
+        if (many) *many = false;
+        return resolve(arg);
+    }
+    *many = true;
+    PyObject* items = PySequence_Fast(arg, "Expected a str label or a sequence of str labels");
+    if (!items) return false;
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(items);
+    PyObject** values = PySequence_Fast_ITEMS(items);
+    for (Py_ssize_t i = 0; i < size; i++) {
+        if (!resolve(values[i])) {
+            Py_DECREF(items);
+            return false;
+        }
+    }
+    Py_DECREF(items);
+    return true;
+}
+
+template<typename G>
+PyObject* Graph_bfs(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"source", "threads", NULL};
+    PyObject* sourceObj;
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|$i", (char**) keywords, &sourceObj, &threads))
+        return NULL;
+    std::vector<int64_t> sources;
+    if (!Algorithm_threads(threads) || !Algorithm_idle(busy)
+        || !Algorithm_sources(graph, sourceObj, sources, NULL))
+        return NULL;
+
+    std::vector<int64_t> distances;
+    if (!Graph_runUnlocked(busy, [&]() {
+        distances = stella::bfsDistances(stella::toCSR(graph), sources[0], threads);
+    })) return NULL;
+    return Array_fromVector(std::move(distances));
+}
+
+// A single source gives 1-D (distances, predecessors); a sequence of sources gives one row per source.
+template<typename G>
+PyObject* Graph_shortestPaths(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"source", "threads", NULL};
+    PyObject* sourceObj;
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|$i", (char**) keywords, &sourceObj, &threads))
+        return NULL;
+    std::vector<int64_t> sources;
+    bool many;
+    if (!Algorithm_threads(threads) || !Algorithm_idle(busy)
+        || !Algorithm_sources(graph, sourceObj, sources, &many))
+        return NULL;
+
+    stella::ShortestPaths paths;
+    if (!Graph_runUnlocked(busy, [&]() {
+        paths = stella::shortestPaths(stella::toCSR(graph), sources, threads);
+    })) return NULL;
+
+    Py_ssize_t rows = sources.size();
+    Py_ssize_t cols = rows ? paths.distances.size() / rows : graph.getAllNodes().size();
+    PyObject* distances = many
+        ? Array_fromVector(std::move(paths.distances), rows, cols)
+        : Array_fromVector(std::move(paths.distances));
+    PyObject* predecessors = many
+        ? Array_fromVector(std::move(paths.predecessors), rows, cols)
+        : Array_fromVector(std::move(paths.predecessors));
+    if (!distances || !predecessors) {
+        Py_XDECREF(distances);
+        Py_XDECREF(predecessors);
+        return NULL;
+    }
+    return Py_BuildValue("(NN)", distances, predecessors);
+}
+
+template<typename G>
+PyObject* Graph_components(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"threads", NULL};
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|$i", (char**) keywords, &threads)
+        || !Algorithm_threads(threads))
+        return NULL;
+
+    std::vector<int64_t> labels;
+    if (!Graph_runUnlocked(busy, [&]() {
+        labels = stella::connectedComponents(stella::toCSR(graph), threads);
+    })) return NULL;
+    return Array_fromVector(std::move(labels));
+}
+
+template<typename G>
+PyObject* Graph_pageRank(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"damping", "iterations", "tolerance", "threads", NULL};
+    double damping = 0.85, tolerance = 1e-6;
+    int iterations = 100;
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|did$i", (char**) keywords,
+        &damping, &iterations, &tolerance, &threads)
+        || !Algorithm_threads(threads))
+        return NULL;
+
+    std::vector<double> ranks;
+    if (!Graph_runUnlocked(busy, [&]() {
+        stella::CSR csr = stella::toCSR(graph);
+        if (stella::is_directed<typename G::EdgeType>::value)
+            ranks = stella::pageRank(csr, stella::transpose(csr), damping, iterations, tolerance, threads);
+        else
+            ranks = stella::pageRank(csr, csr, damping, iterations, tolerance, threads);
+    })) return NULL;
+    return Array_fromVector(std::move(ranks));
+}
+
+// Renumbers the nodes in place; returns the int64 order applied, new index to old index.
+template<typename G>
+PyObject* Graph_reorder(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"strategy", NULL};
+    const char* name = "rcm";
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|s", (char**) keywords, &name))
+        return NULL;
+    std::string strategyName(name);
+    stella::ReorderStrategy strategy;
+    if (strategyName == "rcm") strategy = stella::REORDER_RCM;
+    else if (strategyName == "degree") strategy = stella::REORDER_DEGREE;
+    else if (strategyName == "gorder") strategy = stella::REORDER_GORDER;
+    else {
+        PyErr_SetString(PyExc_ValueError, "strategy must be 'rcm', 'degree' or 'gorder'");
+        return NULL;
+    }
+
+    std::vector<int64_t> order;
+    if (!Graph_runUnlocked(busy, [&]() {
+        order = stella::reorder(graph, strategy);
+    })) return NULL;
+    return Array_fromVector(std::move(order));
+}
+
+/*
+    Subgraphs come back as a new object of the type of `self`, created empty and
+    then filled with the GIL released; `graph` is the member holding the C++ graph.
+*/
+template<typename O, typename G, typename F>
+PyObject* Graph_subgraph(O* self, std::unique_ptr<G> O::*graph, F select) {
+    PyObject* result = PyObject_CallObject((PyObject*) Py_TYPE(self), NULL);
+    if (!result) return NULL;
+    G& source = *(self->*graph);
+    G& subgraph = *(((O*) result)->*graph);
+    if (!Graph_runUnlocked(self->busy, [&]() {
+        source.extractSubgraph(select(source), subgraph);
+    })) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    return result;
+}
+
+template<typename O, typename G>
+PyObject* Graph_khop(O* self, std::unique_ptr<G> O::*graph, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"label", "k", NULL};
+    const char* label;
+    int k;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "si", (char**) keywords, &label, &k))
+        return NULL;
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must be 0 or more");
+        return NULL;
+    }
+    std::string source(label);
+    return Graph_subgraph(self, graph, [&](G& graph) { return stella::khopIndices(graph, source, k); });
+}
+
+template<typename O, typename G>
+PyObject* Graph_inducedSubgraph(O* self, std::unique_ptr<G> O::*graph, PyObject* args) {
+    PyObject* labels;
+    if (!PyArg_ParseTuple(args, "O", &labels)) return NULL;
+    std::vector<int64_t> sources;
+    bool many;
+    if (!Algorithm_idle(self->busy) || !Algorithm_sources(*(self->*graph), labels, sources, &many))
+        return NULL;
+    std::vector<int> indices(sources.begin(), sources.end());
+    return Graph_subgraph(self, graph, [&](G&) { return indices; });
+}
+
+/*
+    Synthetic graphs (see generators.tpp), generated and inserted with the GIL
+    released. The same seed gives the same graph for any thread count.
+*/
+template<typename G>
+PyObject* Graph_generateErdosRenyi(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"n", "p", "seed", "threads", NULL};
+    long long n;
+    double p;
+    unsigned long long seed = 0;
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "Ld|K$i", (char**) keywords, &n, &p, &seed, &threads)
+        || !Algorithm_threads(threads))
+        return NULL;
+    return Bulk_run(graph, busy, [&](G& graph) { stella::generateErdosRenyi(graph, n, p, seed, threads); });
+}
+
+template<typename G>
+PyObject* Graph_generateRMAT(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"scale", "edges", "seed", "a", "b", "c", "threads", NULL};
+    int scale;
+    long long edges;
+    unsigned long long seed = 0;
+    double a = 0.57, b = 0.19, c = 0.19;
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "iL|K$dddi", (char**) keywords,
+        &scale, &edges, &seed, &a, &b, &c, &threads) || !Algorithm_threads(threads))
+        return NULL;
+    return Bulk_run(graph, busy, [&](G& graph) { stella::generateRMAT(graph, scale, edges, seed, threads, a, b, c); });
+}
+
+template<typename G>
+PyObject* Graph_generateBarabasiAlbert(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"n", "m", "seed", "threads", NULL};
+    long long n, m;
+    unsigned long long seed = 0;
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "LL|K$i", (char**) keywords, &n, &m, &seed, &threads)
+        || !Algorithm_threads(threads))
+        return NULL;
+    return Bulk_run(graph, busy, [&](G& graph) { stella::generateBarabasiAlbert(graph, n, m, seed, threads); });
+}
+
+template<typename G>
+PyObject* Graph_generateGrid(G& graph, bool& busy, PyObject* args, PyObject* kwds) {
+    static const char* keywords[] = {"rows", "cols", "drop", "seed", "threads", NULL};
+    long long rows, cols;
+    double drop = 0;
+    unsigned long long seed = 0;
+    int threads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "LL|dK$i", (char**) keywords, &rows, &cols, &drop, &seed, &threads)
+        || !Algorithm_threads(threads))
+        return NULL;
+    return Bulk_run(graph, busy, [&](G& graph) { stella::generateGrid(graph, rows, cols, drop, seed, threads); });
+}
+
+#endif
\ No newline at end of file
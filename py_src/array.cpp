@@ -0,0 +1,112 @@
+#include "array.hpp"
+
+PyObject* Array_create(ArrayStorage* storage, char* data, const char* format, Py_ssize_t itemsize,
+    Py_ssize_t rows, Py_ssize_t cols) {
+    ArrayObject* self = PyObject_New(ArrayObject, &ArrayType);
+    if (!self) {
+        delete storage;
+        return PyErr_NoMemory();
+    }
+    // Empty vectors may have no storage at all, but buffers must not be NULL.
+    static char empty;
+    self->storage = storage;
+    self->data = data ? data : &empty;
+    self->format = format;
+    self->itemsize = itemsize;
+    self->ndim = cols < 0 ? 1 : 2;
+    self->shape[0] = rows;
+    self->shape[1] = cols < 0 ? 0 : cols;
+    self->strides[0] = cols < 0 ? itemsize : itemsize * cols;
+    self->strides[1] = itemsize;
+    return (PyObject*) self;
+}
+
+void Array_dealloc(ArrayObject* self) {
+    delete self->storage;
+    PyObject_Del(self);
+}
+
+Py_ssize_t Array_length(ArrayObject* self) {
+    return self->shape[0];
+}
+
+int Array_getbuffer(ArrayObject* self, Py_buffer* view, int flags) {
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "stella.Array is read-only");
+        view->obj = NULL;
+        return -1;
+    }
+    view->obj = (PyObject*) self;
+    Py_INCREF(self);
+    view->buf = self->data;
+    view->len = self->itemsize * self->shape[0] * (self->ndim == 2 ? self->shape[1] : 1);
+    view->readonly = 1;
+    view->itemsize = self->itemsize;
+    view->format = (flags & PyBUF_FORMAT) ? (char*) self->format : NULL;
+    view->ndim = self->ndim;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+PyBufferProcs Array_as_buffer = {
+    (getbufferproc)Array_getbuffer,
+    NULL,
+};
+
+PySequenceMethods Array_as_sequence = {
+    (lenfunc)Array_length,     /* sq_length */
+};
+
+PyObject* Array_shape(ArrayObject* self, void* closure) {
+    if (self->ndim == 1) return Py_BuildValue("(n)", self->shape[0]);
+    return Py_BuildValue("(nn)", self->shape[0], self->shape[1]);
+}
+
+PyGetSetDef Array_GetSetDef[] = {
+    {"shape", (getter)Array_shape, NULL, "Array dimensions", NULL},
+    {NULL}
+};
+
+PyTypeObject ArrayType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "stella.Array",            /* tp_name */
+    sizeof(ArrayObject),       /* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)Array_dealloc, /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_reserved */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    &Array_as_sequence,        /* tp_as_sequence */
+    0,                         /* tp_as_mapping */
+    0,                         /* tp_hash  */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    &Array_as_buffer,          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,        /* tp_flags */
+    "Read-only array exported through the buffer protocol", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    0,                         /* tp_iter */
+    0,                         /* tp_iternext */
+    0,                         /* tp_methods */
+    0,                         /* tp_members */
+    Array_GetSetDef,           /* tp_getset */
+    0,                         /* tp_base */
+    0,                         /* tp_dict */
+    0,                         /* tp_descr_get */
+    0,                         /* tp_descr_set */
+    0,                         /* tp_dictoffset */
+    0,                         /* tp_init */
+    0,                         /* tp_alloc */
+    0,                         /* tp_new */
+};
\ No newline at end of file
@@ -0,0 +1,117 @@
+#ifndef ARRAY_PYTHON_HPP
+#define ARRAY_PYTHON_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <Python.h>
+
+#include "../cpp_src/stella.hpp"
+
+/*
+    Read-only, contiguous array exposed through the Python buffer protocol.
+    The C++ vector is moved into the object, so `numpy.asarray(array)` or
+    `memoryview(array)` read it without any copy.
+*/
+
+struct ArrayStorage {
+    virtual ~ArrayStorage() {}
+};
+
+template<typename T>
+struct TypedArrayStorage : ArrayStorage {
+    std::vector<T> values;
+    TypedArrayStorage(std::vector<T>&& values) : values(std::move(values)) {}
+};
+
+template<typename T> struct ArrayFormat;
+template<> struct ArrayFormat<int64_t> { static constexpr const char* value = "q"; };
+template<> struct ArrayFormat<int32_t> { static constexpr const char* value = "i"; };
+template<> struct ArrayFormat<double> { static constexpr const char* value = "d"; };
+
+typedef struct {
+    PyObject_HEAD
+    ArrayStorage* storage;
+    char* data;
+    const char* format;
+    Py_ssize_t itemsize;
+    int ndim;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+} ArrayObject;
+
+extern PyTypeObject ArrayType;
+
+PyObject* Array_create(ArrayStorage* storage, char* data, const char* format, Py_ssize_t itemsize,
+    Py_ssize_t rows, Py_ssize_t cols);
+
+// One dimensional array of `values.size()` items.
+template<typename T>
+PyObject* Array_fromVector(std::vector<T>&& values) {
+    TypedArrayStorage<T>* storage = new TypedArrayStorage<T>(std::move(values));
+    return Array_create(storage, (char*)storage->values.data(), ArrayFormat<T>::value, sizeof(T),
+        storage->values.size(), -1);
+}
+
+// Two dimensional, row major array of `rows` x `cols` items.
+template<typename T>
+PyObject* Array_fromVector(std::vector<T>&& values, Py_ssize_t rows, Py_ssize_t cols) {
+    TypedArrayStorage<T>* storage = new TypedArrayStorage<T>(std::move(values));
+    return Array_create(storage, (char*)storage->values.data(), ArrayFormat<T>::value, sizeof(T),
+        rows, cols);
+}
+
+template<typename G>
+PyObject* Graph_edgeArrays(G& graph) {
+    stella::EdgeArrays arrays;
+    try {
+        arrays = stella::toEdgeArrays(graph);
+    } catch (std::invalid_argument& ex) {
+        PyErr_SetString(PyExc_RuntimeError, ex.what());
+        return NULL;
+    }
+    PyObject* sources = Array_fromVector(std::move(arrays.sources));
+    PyObject* targets = Array_fromVector(std::move(arrays.targets));
+    PyObject* weights = Array_fromVector(std::move(arrays.weights));
+    if (!sources || !targets || !weights) {
+        Py_XDECREF(sources);
+        Py_XDECREF(targets);
+        Py_XDECREF(weights);
+        return NULL;
+    }
+    return Py_BuildValue("(NNN)", sources, targets, weights);
+}
+
+template<typename G>
+PyObject* Graph_csr(G& graph) {
+    stella::CSR csr;
+    try {
+        csr = stella::toCSR(graph);
+    } catch (std::invalid_argument& ex) {
+        PyErr_SetString(PyExc_RuntimeError, ex.what());
+        return NULL;
+    }
+    PyObject* offsets = Array_fromVector(std::move(csr.offsets));
+    PyObject* targets = Array_fromVector(std::move(csr.targets));
+    PyObject* weights = Array_fromVector(std::move(csr.weights));
+    if (!offsets || !targets || !weights) {
+        Py_XDECREF(offsets);
+        Py_XDECREF(targets);
+        Py_XDECREF(weights);
+        return NULL;
+    }
+    return Py_BuildValue("(NNN)", offsets, targets, weights);
+}
+
+template<typename G>
+PyObject* Graph_toDense(G& graph) {
+    Py_ssize_t size = graph.getAllNodes().size();
+    try {
+        return Array_fromVector(stella::toDense(graph), size, size);
+    } catch (std::invalid_argument& ex) {
+        PyErr_SetString(PyExc_RuntimeError, ex.what());
+        return NULL;
+    }
+}
+
+#endif
\ No newline at end of file
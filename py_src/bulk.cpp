@@ -0,0 +1,156 @@
+#include "bulk.hpp"
+
+static bool Bulk_toLabel(PyObject* item, std::string& label) {
+    Py_ssize_t size;
+    const char* data = PyUnicode_AsUTF8AndSize(item, &size);
+    if (!data) {
+        PyErr_SetString(PyExc_TypeError, "Labels must be of str type");
+        return false;
+    }
+    label.assign(data, size);
+    return true;
+}
+
+static bool Bulk_fitWeight(long long value, int& weight) {
+    if (value < INT_MIN || value > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "Edge weight does not fit in a C int");
+        return false;
+    }
+    weight = (int) value;
+    return true;
+}
+
+static bool Bulk_toWeight(PyObject* item, int& weight) {
+    long long value = PyLong_AsLongLong(item);
+    if (value == -1 && PyErr_Occurred()) return false;
+    return Bulk_fitWeight(value, weight);
+}
+
+static bool Bulk_collectLabels(PyObject* iterable, std::vector<std::string>& labels) {
+    PyObject* items = PySequence_Fast(iterable, "Expected an iterable of str labels");
+    if (!items) return false;
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(items);
+    PyObject** values = PySequence_Fast_ITEMS(items);
+    labels.resize(size);
+    for (Py_ssize_t i = 0; i < size; i++) {
+        if (!Bulk_toLabel(values[i], labels[i])) {
+            Py_DECREF(items);
+            return false;
+        }
+    }
+    Py_DECREF(items);
+    return true;
+}
+
+// Integer buffers (e.g. NumPy arrays) are read directly, anything else is iterated.
+static bool Bulk_collectWeights(PyObject* iterable, std::vector<int>& weights) {
+    Py_buffer view;
+    if (PyObject_CheckBuffer(iterable)
+        && PyObject_GetBuffer(iterable, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0) {
+        const char* format = view.format ? view.format : "B";
+        if (*format == '@' || *format == '=') format++;
+        bool known = true, fits = true;
+        Py_ssize_t count = view.itemsize > 0 ? view.len / view.itemsize : 0;
+        weights.resize(count);
+        for (Py_ssize_t i = 0; i < count && known && fits; i++) {
+            const char* item = (const char*) view.buf + i * view.itemsize;
+            switch (*format) {
+                case 'q': fits = Bulk_fitWeight(*(const long long*) item, weights[i]); break;
+                case 'l': fits = Bulk_fitWeight(*(const long*) item, weights[i]); break;
+                case 'i': weights[i] = *(const int*) item; break;
+                case 'h': weights[i] = *(const short*) item; break;
+                case 'b': weights[i] = *(const signed char*) item; break;
+                default: known = false;
+            }
+        }
+        PyBuffer_Release(&view);
+        if (!fits) return false;
+        if (known && format[0] != '\0' && format[1] == '\0') return true;
+    }
+    PyErr_Clear();
+
+    PyObject* items = PySequence_Fast(iterable, "Expected an iterable of int weights");
+    if (!items) return false;
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(items);
+    PyObject** values = PySequence_Fast_ITEMS(items);
+    weights.resize(size);
+    for (Py_ssize_t i = 0; i < size; i++) {
+        if (!Bulk_toWeight(values[i], weights[i])) {
+            Py_DECREF(items);
+            return false;
+        }
+    }
+    Py_DECREF(items);
+    return true;
+}
+
+bool Bulk_collectNodes(PyObject* args, std::vector<std::string>& labels) {
+    PyObject* iterable;
+    if (!PyArg_ParseTuple(args, "O", &iterable)) return false;
+    return Bulk_collectLabels(iterable, labels);
+}
+
+static bool Bulk_collectRows(PyObject* iterable, std::vector<stella::EdgeEntry>& entries) {
+    PyObject* rows = PySequence_Fast(iterable, "Expected an iterable of (str, str, str, [int]) tuples");
+    if (!rows) return false;
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(rows);
+    PyObject** values = PySequence_Fast_ITEMS(rows);
+    entries.resize(size);
+    for (Py_ssize_t i = 0; i < size; i++) {
+        PyObject* row = PySequence_Fast(values[i], "Expected an iterable of (str, str, str, [int]) tuples");
+        if (!row) {
+            Py_DECREF(rows);
+            return false;
+        }
+        Py_ssize_t fields = PySequence_Fast_GET_SIZE(row);
+        PyObject** items = PySequence_Fast_ITEMS(row);
+        stella::EdgeEntry& entry = entries[i];
+        entry.weight = 1;
+        bool ok = (fields == 3 || fields == 4)
+            && Bulk_toLabel(items[0], entry.label)
+            && Bulk_toLabel(items[1], entry.n1)
+            && Bulk_toLabel(items[2], entry.n2)
+            && (fields == 3 || Bulk_toWeight(items[3], entry.weight));
+        Py_DECREF(row);
+        if (!ok) {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_TypeError, "Expected an iterable of (str, str, str, [int]) tuples");
+            Py_DECREF(rows);
+            return false;
+        }
+    }
+    Py_DECREF(rows);
+    return true;
+}
+
+bool Bulk_collectEdges(PyObject* args, std::vector<stella::EdgeEntry>& entries) {
+    PyObject *first, *n1s = NULL, *n2s = NULL, *weightsObj = NULL;
+    if (!PyArg_ParseTuple(args, "O|OOO", &first, &n1s, &n2s, &weightsObj)) return false;
+    if (!n1s) return Bulk_collectRows(first, entries);
+    if (!n2s) {
+        PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_edges. Expected an iterable of tuples or (labels, n1s, n2s, [weights]).");
+        return false;
+    }
+
+    std::vector<std::string> labels, n1, n2;
+    std::vector<int> weights;
+    if (!Bulk_collectLabels(first, labels)
+        || !Bulk_collectLabels(n1s, n1)
+        || !Bulk_collectLabels(n2s, n2)
+        || (weightsObj && !Bulk_collectWeights(weightsObj, weights)))
+        return false;
+    if (n1.size() != labels.size() || n2.size() != labels.size()
+        || (weightsObj && weights.size() != labels.size())) {
+        PyErr_SetString(PyExc_ValueError, "add_edges columns must all have the same length");
+        return false;
+    }
+
+    entries.resize(labels.size());
+    for (size_t i = 0; i < labels.size(); i++) {
+        entries[i].label = std::move(labels[i]);
+        entries[i].n1 = std::move(n1[i]);
+        entries[i].n2 = std::move(n2[i]);
+        entries[i].weight = weightsObj ? weights[i] : 1;
+    }
+    return true;
+}
\ No newline at end of file
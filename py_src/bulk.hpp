@@ -0,0 +1,78 @@
+#ifndef BULK_PYTHON_HPP
+#define BULK_PYTHON_HPP
+
+#include <climits>
+#include <exception>
+#include <string>
+#include <vector>
+#include <Python.h>
+
+#include "../cpp_src/stella.hpp"
+
+/*
+    Bulk insertion for the graph types. Every label and weight is first extracted
+    into C++ buffers while holding the GIL; the insertion itself then runs with the
+    GIL released, so other Python threads keep running during a large ingest.
+    While that happens the graph is flagged as busy and rejects any other access.
+*/
+
+#define GRAPH_ENSURE_IDLE(self, result) \
+    if ((self)->busy) { \
+        PyErr_SetString(PyExc_RuntimeError, "Graph is busy with a bulk operation in another thread"); \
+        return result; \
+    }
+
+bool Bulk_collectNodes(PyObject* args, std::vector<std::string>& labels);
+
+bool Bulk_collectEdges(PyObject* args, std::vector<stella::EdgeEntry>& entries);
+
+/*
+    Runs `work` with the GIL released while the graph is flagged as busy.
+    Returns false with a RuntimeError set if the graph was already busy or `work` threw.
+*/
+template<typename F>
+bool Graph_runUnlocked(bool& busy, F work) {
+    if (busy) {
+        PyErr_SetString(PyExc_RuntimeError, "Graph is busy with a bulk operation in another thread");
+        return false;
+    }
+    std::string error;
+    bool failed = false;
+    busy = true;
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        work();
+    } catch (std::exception& ex) {
+        failed = true;
+        error = ex.what();
+    }
+    Py_END_ALLOW_THREADS
+    busy = false;
+    if (failed) {
+        PyErr_SetString(PyExc_RuntimeError, error.c_str());
+        return false;
+    }
+    return true;
+}
+
+template<typename G, typename F>
+PyObject* Bulk_run(G& graph, bool& busy, F insert) {
+    if (!Graph_runUnlocked(busy, [&graph, &insert]() { insert(graph); })) return NULL;
+    Py_RETURN_NONE;
+}
+
+template<typename G>
+PyObject* Graph_addNodes(G& graph, bool& busy, PyObject* args) {
+    std::vector<std::string> labels;
+    if (!Bulk_collectNodes(args, labels)) return NULL;
+    return Bulk_run(graph, busy, [&labels](G& graph) { graph.addNodes(labels); });
+}
+
+template<typename G>
+PyObject* Graph_addEdges(G& graph, bool& busy, PyObject* args) {
+    std::vector<stella::EdgeEntry> entries;
+    if (!Bulk_collectEdges(args, entries)) return NULL;
+    return Bulk_run(graph, busy, [&entries](G& graph) { graph.addEdges(entries); });
+}
+
+#endif
\ No newline at end of file
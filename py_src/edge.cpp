@@ -1,7 +1,11 @@
 #include "edge.hpp"
+#include "wrappers.hpp"
 
 void BaseEdge_dealloc(BaseEdgeObject *self) {
+    if (self->cache) self->cache->release(self->edge->get(), (PyObject *) self);
     delete self->edge;
+    Py_XDECREF(self->n1);
+    Py_XDECREF(self->n2);
     Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
@@ -9,7 +13,10 @@ PyObject *BaseEdge_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
     BaseEdgeObject *self;
     self = (BaseEdgeObject *)type->tp_alloc(type, 0);
     if (self != NULL) {
+        self->cache = nullptr;
         self->edge = nullptr;
+        self->n1 = NULL;
+        self->n2 = NULL;
     }
     return (PyObject *)self;
 }
@@ -31,6 +38,10 @@ int BaseEdge_init(BaseEdgeObject *self, PyObject *args, PyObject *kwds) {
     shared_ptr<stella::Node>* n1 = n1_obj->node;
     shared_ptr<stella::Node>* n2 = n2_obj->node;
     self->edge = new (shared_ptr<stella::BaseEdge>) (make_shared<stella::BaseEdge>(label, *n1, *n2, weight));
+    Py_INCREF(n1_obj);
+    Py_XSETREF(self->n1, (PyObject *) n1_obj);
+    Py_INCREF(n2_obj);
+    Py_XSETREF(self->n2, (PyObject *) n2_obj);
     return 0;
 }
 
@@ -45,17 +56,23 @@ PyObject *BaseEdge_label(BaseEdgeObject *self) {
 }
 
 PyObject *BaseEdge_n1(BaseEdgeObject *self) {
-    shared_ptr<stella::Node> node = self->edge->get()->getN1();
-    NodeObject* nodeObject = PyObject_New(NodeObject, &NodeType);
-    nodeObject->node = new shared_ptr<stella::Node>(node);
-    return (PyObject *) nodeObject;
+    if (!self->n1) {
+        shared_ptr<stella::Node> node = self->edge->get()->getN1();
+        self->n1 = self->cache ? self->cache->get(node) : Node_wrap(node);
+        if (!self->n1) return NULL;
+    }
+    Py_INCREF(self->n1);
+    return self->n1;
 }
 
 PyObject *BaseEdge_n2(BaseEdgeObject *self) {
-    shared_ptr<stella::Node> node =  self->edge->get()->getN2();
-    NodeObject* nodeObject = PyObject_New(NodeObject, &NodeType);
-    nodeObject->node = new shared_ptr<stella::Node>(node);
-    return (PyObject *) nodeObject;
+    if (!self->n2) {
+        shared_ptr<stella::Node> node = self->edge->get()->getN2();
+        self->n2 = self->cache ? self->cache->get(node) : Node_wrap(node);
+        if (!self->n2) return NULL;
+    }
+    Py_INCREF(self->n2);
+    return self->n2;
 }
 
 PyObject *BaseEdge_weight(BaseEdgeObject* self) {
@@ -76,8 +93,8 @@ PyObject *BaseEdge_richcompare(PyObject* first, PyObject* second, int op) {
     || !PyObject_IsInstance(second, (PyObject *)&BaseEdgeType))
         Py_RETURN_NOTIMPLEMENTED;
 
-    stella::BaseEdge e1 = *(((BaseEdgeObject *)first)->edge->get());
-    stella::BaseEdge e2 = *(((BaseEdgeObject *)second)->edge->get());
+    const stella::BaseEdge& e1 = *(((BaseEdgeObject *)first)->edge->get());
+    const stella::BaseEdge& e2 = *(((BaseEdgeObject *)second)->edge->get());
 
     bool result = false;
     switch (op) {
@@ -147,6 +164,16 @@ PyTypeObject BaseEdgeType = {
     BaseEdge_new,              /* tp_new */
 };
 
+PyObject *Edge_wrap(const shared_ptr<stella::Edge>& edge) {
+    EdgeObject* self = PyObject_New(EdgeObject, &EdgeType);
+    if (!self) return PyErr_NoMemory();
+    self->cache = nullptr;
+    self->edge = new shared_ptr<stella::Edge>(edge);
+    self->n1 = NULL;
+    self->n2 = NULL;
+    return (PyObject *) self;
+}
+
 PyTypeObject EdgeType = {
     PyVarObject_HEAD_INIT(NULL, 0)
     "stella.Edge",             /* tp_name */
@@ -188,6 +215,16 @@ PyTypeObject EdgeType = {
     0,                         /* tp_new */
 };
 
+PyObject *DirectedEdge_wrap(const shared_ptr<stella::DirectedEdge>& edge) {
+    DirectedEdgeObject* self = PyObject_New(DirectedEdgeObject, &DirectedEdgeType);
+    if (!self) return PyErr_NoMemory();
+    self->cache = nullptr;
+    self->edge = new shared_ptr<stella::DirectedEdge>(edge);
+    self->n1 = NULL;
+    self->n2 = NULL;
+    return (PyObject *) self;
+}
+
 PyObject *DirectedEdge_str(DirectedEdgeObject *self) {
     std::ostringstream oss;
     oss << self->edge->get();
@@ -201,8 +238,8 @@ PyObject *DirectedEdge_richcompare(PyObject* first, PyObject* second, int op) {
 
     bool result = false;
 
-    stella::DirectedEdge e1 = *(((DirectedEdgeObject *)first)->edge->get());
-    stella::DirectedEdge e2 = *(((DirectedEdgeObject *)second)->edge->get());
+    const stella::DirectedEdge& e1 = *(((DirectedEdgeObject *)first)->edge->get());
+    const stella::DirectedEdge& e2 = *(((DirectedEdgeObject *)second)->edge->get());
 
     switch (op) {
         case Py_EQ:
@@ -11,9 +11,14 @@
 using std::make_shared;
 using std::shared_ptr;
 
+// n1 and n2 cache the Node wrappers of the endpoints, created on first access. For an edge
+// handed out by a graph they come from that graph's cache, so they are its Node objects.
 typedef struct {
     PyObject_HEAD
+    WrapperCache* cache;
     shared_ptr<stella::BaseEdge>* edge;
+    PyObject* n1;
+    PyObject* n2;
 } BaseEdgeObject;
 
 void BaseEdge_dealloc(BaseEdgeObject *self);
@@ -38,18 +43,29 @@ extern PyTypeObject BaseEdgeType;
 
 typedef struct {
     PyObject_HEAD
+    WrapperCache* cache;
     shared_ptr<stella::Edge>* edge;
+    PyObject* n1;
+    PyObject* n2;
 } EdgeObject;
 
+// Wraps an edge that is owned by a graph.
+PyObject *Edge_wrap(const shared_ptr<stella::Edge>& edge);
+
 extern PyTypeObject EdgeType;
 
 /* ******************** DIRECTEDEDGE IMPL STARTED  **************************/
 
 typedef struct {
     PyObject_HEAD
+    WrapperCache* cache;
     shared_ptr<stella::DirectedEdge>* edge;
+    PyObject* n1;
+    PyObject* n2;
 } DirectedEdgeObject;
 
+PyObject *DirectedEdge_wrap(const shared_ptr<stella::DirectedEdge>& edge);
+
 PyObject *DirectedEdge_str(DirectedEdgeObject *self);
 
 PyObject *DirectedEdge_richcompare(PyObject* first, PyObject* second, int op);
@@ -0,0 +1,22 @@
+#ifndef MEMORY_PYTHON_HPP
+#define MEMORY_PYTHON_HPP
+
+#include <Python.h>
+
+#include "../cpp_src/stella.hpp"
+
+// Returns `Graph::memoryUsage()` as a dict of byte counts, plus their total.
+template<typename G>
+PyObject* Graph_memoryUsage(G& graph) {
+    stella::MemoryUsage usage = graph.memoryUsage();
+    return Py_BuildValue("{s:n,s:n,s:n,s:n,s:n,s:n,s:n}",
+        "nodes", (Py_ssize_t) usage.nodes,
+        "edges", (Py_ssize_t) usage.edges,
+        "labels", (Py_ssize_t) usage.labels,
+        "control_blocks", (Py_ssize_t) usage.controlBlocks,
+        "containers", (Py_ssize_t) usage.containers,
+        "matrix_cells", (Py_ssize_t) usage.matrixCells,
+        "total", (Py_ssize_t) usage.total());
+}
+
+#endif
\ No newline at end of file
@@ -1,14 +1,26 @@
 #include "node.hpp"
+#include "wrappers.hpp"
 
 void Node_dealloc(NodeObject *self) {
+    if (self->cache) self->cache->release(self->node->get(), (PyObject *) self);
     delete self->node;
     Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
+PyObject *Node_wrap(const shared_ptr<stella::Node>& node) {
+    NodeObject* self = PyObject_New(NodeObject, &NodeType);
+    if (!self) return PyErr_NoMemory();
+    self->cache = nullptr;
+    self->node = new shared_ptr<stella::Node>(node);
+    self->isOwner = false;
+    return (PyObject *) self;
+}
+
 PyObject *Node_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
     NodeObject *self;
     self = (NodeObject *)type->tp_alloc(type, 0);
     if (self != NULL) {
+        self->cache = nullptr;
         self->node = nullptr;
     }
     return (PyObject *)self;
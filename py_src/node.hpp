@@ -9,14 +9,26 @@
 using std::make_shared;
 using std::shared_ptr;
 
+class WrapperCache;
+
+// Node and edge wrappers start with the graph cache holding them, if any (see wrappers.hpp).
 typedef struct {
     PyObject_HEAD
+    WrapperCache* cache;
+} CachedObject;
+
+typedef struct {
+    PyObject_HEAD
+    WrapperCache* cache;
     shared_ptr<stella::Node>* node;
     bool isOwner;
 } NodeObject;
 
 void Node_dealloc(NodeObject *self);
 
+// Wraps a node that is owned by a graph.
+PyObject *Node_wrap(const shared_ptr<stella::Node>& node);
+
 PyObject *Node_new(PyTypeObject *type, PyObject *args, PyObject *kwds);
 
 int Node_init(NodeObject *self, PyObject *args, PyObject *kwds);
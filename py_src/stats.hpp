@@ -0,0 +1,70 @@
+#ifndef STATS_PYTHON_HPP
+#define STATS_PYTHON_HPP
+
+#include <Python.h>
+
+#include "../cpp_src/stella.hpp"
+
+/*
+    Python access to the graph instrumentation (cpp_src/stats.hpp). The extension
+    records it only when built with STELLA_STATS=1 in the environment; otherwise
+    `stats()` returns None and `reset_stats()` does nothing.
+*/
+
+#ifdef STELLA_STATS
+
+inline PyObject* Stats_operation(const stella::OperationStats& stats) {
+    const stella::LatencyHistogram& latency = stats.latency;
+    int used = stella::LatencyHistogram::BUCKETS;
+    while (used > 0 && latency.buckets[used - 1] == 0) used--;
+    PyObject* histogram = PyList_New(used);
+    if (!histogram) return NULL;
+    for (int i = 0; i < used; i++)
+        PyList_SET_ITEM(histogram, i, PyLong_FromUnsignedLongLong(latency.buckets[i]));
+    return Py_BuildValue("{s:K,s:K,s:K,s:K,s:K,s:K,s:N}",
+        "count", (unsigned long long) stats.count,
+        "failed", (unsigned long long) stats.failed,
+        "total_ns", (unsigned long long) latency.totalNs,
+        "max_ns", (unsigned long long) latency.maxNs,
+        "p50_ns", (unsigned long long) latency.quantile(0.5),
+        "p99_ns", (unsigned long long) latency.quantile(0.99),
+        "histogram", histogram);
+}
+
+template<typename G>
+PyObject* Graph_stats(G& graph) {
+    const stella::GraphStats& stats = graph.getStats();
+    return Py_BuildValue("{s:N,s:N,s:N,s:N,s:N,s:N,s:N,s:N,s:K,s:K}",
+        "node_inserts", Stats_operation(stats.nodeInserts),
+        "edge_inserts", Stats_operation(stats.edgeInserts),
+        "node_lookups", Stats_operation(stats.nodeLookups),
+        "edge_lookups", Stats_operation(stats.edgeLookups),
+        "bulk_node_inserts", Stats_operation(stats.bulkNodeInserts),
+        "bulk_edge_inserts", Stats_operation(stats.bulkEdgeInserts),
+        "node_removals", Stats_operation(stats.nodeRemovals),
+        "edge_removals", Stats_operation(stats.edgeRemovals),
+        "growths", (unsigned long long) stats.growths,
+        "reallocations", (unsigned long long) stats.reallocations);
+}
+
+template<typename G>
+PyObject* Graph_resetStats(G& graph) {
+    graph.resetStats();
+    Py_RETURN_NONE;
+}
+
+#else
+
+template<typename G>
+PyObject* Graph_stats(G& graph) {
+    Py_RETURN_NONE;
+}
+
+template<typename G>
+PyObject* Graph_resetStats(G& graph) {
+    Py_RETURN_NONE;
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include "graph.hpp"
 #include "adj_list.hpp"
 #include "adj_matrix.hpp"
+#include "array.hpp"
+#include "views.hpp"
 
 static PyModuleDef stellaModule = {
     PyModuleDef_HEAD_INIT,
@@ -32,7 +34,13 @@ PyInit_stella(void) {
         PyType_Ready(&AdjListType) < 0 ||
         PyType_Ready(&DirectedAdjListType) < 0 ||
         PyType_Ready(&AdjMatrixType) < 0 ||
-        PyType_Ready(&DirectedAdjMatrixType) < 0) {
+        PyType_Ready(&DirectedAdjMatrixType) < 0 ||
+        PyType_Ready(&ArrayType) < 0 ||
+        PyType_Ready(&NodeViewType) < 0 ||
+        PyType_Ready(&EdgeViewType) < 0 ||
+        PyType_Ready(&EdgeViewIterType) < 0 ||
+        PyType_Ready(&MatrixViewType) < 0 ||
+        PyType_Ready(&MatrixRowType) < 0) {
         return NULL;
     }
 
@@ -106,5 +114,12 @@ PyInit_stella(void) {
         return NULL;
     }
 
+    Py_INCREF(&ArrayType);
+    if (PyModule_AddObject(m, "Array", (PyObject *)&ArrayType) < 0) {
+        Py_DECREF(&ArrayType);
+        Py_DECREF(m);
+        return NULL;
+    }
+
     return m;
 }
\ No newline at end of file
@@ -0,0 +1,408 @@
+#include "views.hpp"
+
+static bool View_idle(GraphViewObject* self) {
+    if (self->source->busy()) {
+        PyErr_SetString(PyExc_RuntimeError, "Graph is busy with a bulk operation in another thread");
+        return false;
+    }
+    return true;
+}
+
+static bool View_label(PyObject* key, std::string& label) {
+    Py_ssize_t size;
+    const char* data = PyUnicode_AsUTF8AndSize(key, &size);
+    if (!data) return false;
+    label.assign(data, size);
+    return true;
+}
+
+PyObject* View_create(PyTypeObject* type, PyObject* owner, GraphSource* source) {
+    GraphViewObject* self = PyObject_New(GraphViewObject, type);
+    if (!self) {
+        delete source;
+        return PyErr_NoMemory();
+    }
+    Py_INCREF(owner);
+    self->owner = owner;
+    self->source = source;
+    return (PyObject*) self;
+}
+
+void View_dealloc(GraphViewObject* self) {
+    delete self->source;
+    Py_DECREF(self->owner);
+    PyObject_Del(self);
+}
+
+Py_ssize_t View_nodeCount(GraphViewObject* self) {
+    if (!View_idle(self)) return -1;
+    return self->source->nodeCount();
+}
+
+/* ******************** NODEVIEW IMPL STARTED  **************************/
+
+PyObject* NodeView_item(GraphViewObject* self, Py_ssize_t index) {
+    if (!View_idle(self)) return NULL;
+    if (index < 0 || index >= self->source->nodeCount()) {
+        PyErr_SetString(PyExc_IndexError, "node index out of range");
+        return NULL;
+    }
+    return self->source->node(index);
+}
+
+int NodeView_contains(GraphViewObject* self, PyObject* value) {
+    if (!View_idle(self)) return -1;
+    std::string label;
+    if (PyObject_IsInstance(value, (PyObject*)&NodeType))
+        label = ((NodeObject*) value)->node->get()->getLabel();
+    else if (!View_label(value, label)) {
+        PyErr_Clear();
+        return 0;
+    }
+    return self->source->nodeIndex(label) >= 0;
+}
+
+PyObject* NodeView_iter(GraphViewObject* self) {
+    return PySeqIter_New((PyObject*) self);
+}
+
+PySequenceMethods NodeView_as_sequence = {
+    (lenfunc)View_nodeCount,       /* sq_length */
+    0,                             /* sq_concat */
+    0,                             /* sq_repeat */
+    (ssizeargfunc)NodeView_item,   /* sq_item */
+    0,                             /* was_sq_slice */
+    0,                             /* sq_ass_item */
+    0,                             /* was_sq_ass_slice */
+    (objobjproc)NodeView_contains, /* sq_contains */
+};
+
+PyTypeObject NodeViewType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "stella.NodeView",         /* tp_name */
+    sizeof(GraphViewObject),   /* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)View_dealloc,  /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_reserved */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    &NodeView_as_sequence,     /* tp_as_sequence */
+    0,                         /* tp_as_mapping */
+    0,                         /* tp_hash  */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    0,                         /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,        /* tp_flags */
+    "Live view over the nodes of a graph", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    (getiterfunc)NodeView_iter,/* tp_iter */
+};
+
+/* ******************** EDGEVIEW IMPL STARTED  **************************/
+
+Py_ssize_t EdgeView_length(GraphViewObject* self) {
+    if (!View_idle(self)) return -1;
+    return self->source->edgeCount();
+}
+
+PyObject* EdgeView_subscript(GraphViewObject* self, PyObject* key) {
+    if (!View_idle(self)) return NULL;
+    std::string label;
+    if (!View_label(key, label)) return NULL;
+    PyObject* edge = self->source->edge(label);
+    if (!edge && !PyErr_Occurred()) PyErr_SetObject(PyExc_KeyError, key);
+    return edge;
+}
+
+int EdgeView_contains(GraphViewObject* self, PyObject* key) {
+    if (!View_idle(self)) return -1;
+    std::string label;
+    if (!View_label(key, label)) {
+        PyErr_Clear();
+        return 0;
+    }
+    return self->source->hasEdgeLabel(label);
+}
+
+PyObject* EdgeView_createIter(GraphViewObject* self, ViewIterKind kind) {
+    EdgeViewIterObject* iter = PyObject_New(EdgeViewIterObject, &EdgeViewIterType);
+    if (!iter) return PyErr_NoMemory();
+    Py_INCREF(self);
+    iter->view = self;
+    iter->last = nullptr;
+    iter->kind = kind;
+    return (PyObject*) iter;
+}
+
+PyObject* EdgeView_iter(GraphViewObject* self) {
+    return EdgeView_createIter(self, VIEW_ITER_KEYS);
+}
+
+PyObject* EdgeView_keys(GraphViewObject* self, PyObject* args) {
+    return EdgeView_createIter(self, VIEW_ITER_KEYS);
+}
+
+PyObject* EdgeView_values(GraphViewObject* self, PyObject* args) {
+    return EdgeView_createIter(self, VIEW_ITER_VALUES);
+}
+
+PyObject* EdgeView_items(GraphViewObject* self, PyObject* args) {
+    return EdgeView_createIter(self, VIEW_ITER_ITEMS);
+}
+
+PyObject* EdgeView_get(GraphViewObject* self, PyObject* args) {
+    PyObject* key;
+    PyObject* fallback = Py_None;
+    if (!PyArg_ParseTuple(args, "O|O", &key, &fallback)) return NULL;
+    if (!View_idle(self)) return NULL;
+    std::string label;
+    if (!View_label(key, label)) return NULL;
+    PyObject* edge = self->source->edge(label);
+    if (edge || PyErr_Occurred()) return edge;
+    Py_INCREF(fallback);
+    return fallback;
+}
+
+PyMethodDef EdgeView_methods[] = {
+    {"keys", (PyCFunction)EdgeView_keys, METH_NOARGS, "Iterate over the edge labels."},
+    {"values", (PyCFunction)EdgeView_values, METH_NOARGS, "Iterate over the edges."},
+    {"items", (PyCFunction)EdgeView_items, METH_NOARGS, "Iterate over (label, edge) pairs."},
+    {"get", (PyCFunction)EdgeView_get, METH_VARARGS, "Get an edge by label, or a default value."},
+    {NULL, NULL, 0, NULL}
+};
+
+PyMappingMethods EdgeView_as_mapping = {
+    (lenfunc)EdgeView_length,        /* mp_length */
+    (binaryfunc)EdgeView_subscript,  /* mp_subscript */
+    0,                               /* mp_ass_subscript */
+};
+
+PySequenceMethods EdgeView_as_sequence = {
+    0,                             /* sq_length */
+    0,                             /* sq_concat */
+    0,                             /* sq_repeat */
+    0,                             /* sq_item */
+    0,                             /* was_sq_slice */
+    0,                             /* sq_ass_item */
+    0,                             /* was_sq_ass_slice */
+    (objobjproc)EdgeView_contains, /* sq_contains */
+};
+
+PyTypeObject EdgeViewType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "stella.EdgeView",         /* tp_name */
+    sizeof(GraphViewObject),   /* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)View_dealloc,  /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_reserved */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    &EdgeView_as_sequence,     /* tp_as_sequence */
+    &EdgeView_as_mapping,      /* tp_as_mapping */
+    0,                         /* tp_hash  */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    0,                         /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,        /* tp_flags */
+    "Live view over the edges of an adjacency list, keyed by label", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    (getiterfunc)EdgeView_iter,/* tp_iter */
+    0,                         /* tp_iternext */
+    EdgeView_methods,          /* tp_methods */
+};
+
+void EdgeViewIter_dealloc(EdgeViewIterObject* self) {
+    delete self->last;
+    Py_DECREF(self->view);
+    PyObject_Del(self);
+}
+
+PyObject* EdgeViewIter_next(EdgeViewIterObject* self) {
+    if (!View_idle(self->view)) return NULL;
+    std::string label;
+    if (!self->view->source->nextEdgeLabel(self->last, label)) return NULL;
+    if (!self->last) self->last = new std::string(label);
+    else *self->last = label;
+
+    if (self->kind == VIEW_ITER_KEYS)
+        return PyUnicode_FromStringAndSize(label.data(), label.size());
+    PyObject* edge = self->view->source->edge(label);
+    if (!edge || self->kind == VIEW_ITER_VALUES) return edge;
+    PyObject* key = PyUnicode_FromStringAndSize(label.data(), label.size());
+    if (!key) {
+        Py_DECREF(edge);
+        return NULL;
+    }
+    return Py_BuildValue("(NN)", key, edge);
+}
+
+PyTypeObject EdgeViewIterType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "stella.EdgeViewIterator", /* tp_name */
+    sizeof(EdgeViewIterObject),/* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)EdgeViewIter_dealloc, /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_reserved */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    0,                         /* tp_as_sequence */
+    0,                         /* tp_as_mapping */
+    0,                         /* tp_hash  */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    0,                         /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,        /* tp_flags */
+    "Iterator over an EdgeView", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    PyObject_SelfIter,         /* tp_iter */
+    (iternextfunc)EdgeViewIter_next, /* tp_iternext */
+};
+
+/* ******************** MATRIXVIEW IMPL STARTED  **************************/
+
+PyObject* MatrixView_item(GraphViewObject* self, Py_ssize_t index) {
+    if (!View_idle(self)) return NULL;
+    if (index < 0 || index >= self->source->nodeCount()) {
+        PyErr_SetString(PyExc_IndexError, "matrix row out of range");
+        return NULL;
+    }
+    MatrixRowObject* row = PyObject_New(MatrixRowObject, &MatrixRowType);
+    if (!row) return PyErr_NoMemory();
+    Py_INCREF(self);
+    row->matrix = self;
+    row->row = index;
+    return (PyObject*) row;
+}
+
+int MatrixView_contains(GraphViewObject* self, PyObject* value) {
+    if (!View_idle(self)) return -1;
+    if (!PyObject_IsInstance(value, (PyObject*)&BaseEdgeType)) return 0;
+    return self->source->hasEdge(((BaseEdgeObject*) value)->edge->get());
+}
+
+PyObject* MatrixView_iter(GraphViewObject* self) {
+    return PySeqIter_New((PyObject*) self);
+}
+
+PySequenceMethods MatrixView_as_sequence = {
+    (lenfunc)View_nodeCount,         /* sq_length */
+    0,                               /* sq_concat */
+    0,                               /* sq_repeat */
+    (ssizeargfunc)MatrixView_item,   /* sq_item */
+    0,                               /* was_sq_slice */
+    0,                               /* sq_ass_item */
+    0,                               /* was_sq_ass_slice */
+    (objobjproc)MatrixView_contains, /* sq_contains */
+};
+
+PyTypeObject MatrixViewType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "stella.MatrixView",       /* tp_name */
+    sizeof(GraphViewObject),   /* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)View_dealloc,  /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_reserved */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    &MatrixView_as_sequence,   /* tp_as_sequence */
+    0,                         /* tp_as_mapping */
+    0,                         /* tp_hash  */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    0,                         /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,        /* tp_flags */
+    "Live view over the rows of an adjacency matrix", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    (getiterfunc)MatrixView_iter, /* tp_iter */
+};
+
+void MatrixRow_dealloc(MatrixRowObject* self) {
+    Py_DECREF(self->matrix);
+    PyObject_Del(self);
+}
+
+Py_ssize_t MatrixRow_length(MatrixRowObject* self) {
+    return View_nodeCount(self->matrix);
+}
+
+PyObject* MatrixRow_item(MatrixRowObject* self, Py_ssize_t index) {
+    if (!View_idle(self->matrix)) return NULL;
+    Py_ssize_t size = self->matrix->source->nodeCount();
+    if (self->row >= size || index < 0 || index >= size) {
+        PyErr_SetString(PyExc_IndexError, "matrix column out of range");
+        return NULL;
+    }
+    return self->matrix->source->cell(self->row, index);
+}
+
+PyObject* MatrixRow_iter(MatrixRowObject* self) {
+    return PySeqIter_New((PyObject*) self);
+}
+
+PySequenceMethods MatrixRow_as_sequence = {
+    (lenfunc)MatrixRow_length,       /* sq_length */
+    0,                               /* sq_concat */
+    0,                               /* sq_repeat */
+    (ssizeargfunc)MatrixRow_item,    /* sq_item */
+};
+
+PyTypeObject MatrixRowType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "stella.MatrixRow",        /* tp_name */
+    sizeof(MatrixRowObject),   /* tp_basicsize */
+    0,                         /* tp_itemsize */
+    (destructor)MatrixRow_dealloc, /* tp_dealloc */
+    0,                         /* tp_print */
+    0,                         /* tp_getattr */
+    0,                         /* tp_setattr */
+    0,                         /* tp_reserved */
+    0,                         /* tp_repr */
+    0,                         /* tp_as_number */
+    &MatrixRow_as_sequence,    /* tp_as_sequence */
+    0,                         /* tp_as_mapping */
+    0,                         /* tp_hash  */
+    0,                         /* tp_call */
+    0,                         /* tp_str */
+    0,                         /* tp_getattro */
+    0,                         /* tp_setattro */
+    0,                         /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,        /* tp_flags */
+    "Live view over one row of an adjacency matrix; each cell is a dict of edges", /* tp_doc */
+    0,                         /* tp_traverse */
+    0,                         /* tp_clear */
+    0,                         /* tp_richcompare */
+    0,                         /* tp_weaklistoffset */
+    (getiterfunc)MatrixRow_iter, /* tp_iter */
+};
\ No newline at end of file
@@ -0,0 +1,161 @@
+#ifndef VIEWS_PYTHON_HPP
+#define VIEWS_PYTHON_HPP
+
+#include <memory>
+#include <string>
+#include <Python.h>
+
+#include "../cpp_src/stella.hpp"
+
+#include "node.hpp"
+#include "edge.hpp"
+#include "wrappers.hpp"
+
+using std::shared_ptr;
+using std::unique_ptr;
+
+/*
+    Live views returned by the `nodes` and `edges` properties. They read the C++
+    containers of the graph on every access and only build Node/Edge wrappers for
+    the items actually requested, so `len(graph.edges)` is O(1) and iterating does
+    not materialize the whole container.
+
+    `GraphSource` hides the concrete graph type from the view types.
+*/
+
+class GraphSource {
+    public:
+        virtual ~GraphSource() {}
+        virtual bool busy() = 0;
+        virtual Py_ssize_t nodeCount() = 0;
+        virtual PyObject* node(Py_ssize_t index) = 0;
+        virtual int nodeIndex(const std::string& label) = 0;
+        // Adjacency list edges, keyed and ordered by label.
+        virtual Py_ssize_t edgeCount() { return 0; }
+        virtual PyObject* edge(const std::string& label) { return NULL; }
+        virtual bool hasEdgeLabel(const std::string& label) { return false; }
+        virtual bool nextEdgeLabel(const std::string* last, std::string& label) { return false; }
+        // Adjacency matrix cells.
+        virtual PyObject* cell(Py_ssize_t row, Py_ssize_t column) { return NULL; }
+        virtual bool hasEdge(stella::BaseEdge* edge) { return false; }
+};
+
+// Holds the graph's unique_ptr rather than the graph itself, since __init__ replaces
+// the graph while existing views stay alive.
+template<typename G>
+class NodeSource : public GraphSource {
+    protected:
+        unique_ptr<G>* holder;
+        bool* busyFlag;
+        WrapperCache* wrappers;
+        G* graph() {
+            return holder->get();
+        }
+    public:
+        NodeSource(unique_ptr<G>* holder, bool* busyFlag, WrapperCache* wrappers)
+            : holder(holder), busyFlag(busyFlag), wrappers(wrappers) {}
+        bool busy() override {
+            return *busyFlag;
+        }
+        Py_ssize_t nodeCount() override {
+            return graph()->getAllNodes().size();
+        }
+        PyObject* node(Py_ssize_t index) override {
+            return wrappers->get(graph()->getAllNodes()[index]);
+        }
+        int nodeIndex(const std::string& label) override {
+            return graph()->getNodeIndex(label);
+        }
+};
+
+template<typename G>
+class ListSource : public NodeSource<G> {
+    public:
+        ListSource(unique_ptr<G>* holder, bool* busyFlag, WrapperCache* wrappers)
+            : NodeSource<G>(holder, busyFlag, wrappers) {}
+        Py_ssize_t edgeCount() override {
+            return this->graph()->getAllEdges().size();
+        }
+        PyObject* edge(const std::string& label) override {
+            auto edge = this->graph()->getEdge(label);
+            if (!edge) return NULL;
+            return this->wrappers->get(edge);
+        }
+        bool hasEdgeLabel(const std::string& label) override {
+            return this->graph()->getEdge(label) != nullptr;
+        }
+        // Resumes from the last label instead of holding a map iterator, so iterating
+        // stays valid while the graph changes.
+        bool nextEdgeLabel(const std::string* last, std::string& label) override {
+            auto& edges = this->graph()->getAllEdges();
+            auto it = last ? edges.upper_bound(*last) : edges.begin();
+            if (it == edges.end()) return false;
+            label = it->first;
+            return true;
+        }
+};
+
+template<typename G>
+class MatrixSource : public NodeSource<G> {
+    public:
+        MatrixSource(unique_ptr<G>* holder, bool* busyFlag, WrapperCache* wrappers)
+            : NodeSource<G>(holder, busyFlag, wrappers) {}
+        PyObject* cell(Py_ssize_t row, Py_ssize_t column) override {
+            PyObject* pyDict = PyDict_New();
+            if (!pyDict) return NULL;
+            for (auto& pair : this->graph()->getAllEdges()[row][column]) {
+                PyObject* value = this->wrappers->get(pair.second);
+                if (!value || PyDict_SetItemString(pyDict, pair.first.c_str(), value) < 0) {
+                    Py_XDECREF(value);
+                    Py_DECREF(pyDict);
+                    return NULL;
+                }
+                Py_DECREF(value);
+            }
+            return pyDict;
+        }
+        bool hasEdge(stella::BaseEdge* edge) override {
+            int n1 = this->graph()->getNodeIndex(edge->getN1()->getLabel());
+            int n2 = this->graph()->getNodeIndex(edge->getN2()->getLabel());
+            if (n1 < 0 || n2 < 0) return false;
+            auto& cell = this->graph()->getAllEdges()[n1][n2];
+            return cell.find(edge->getLabel()) != cell.end();
+        }
+};
+
+typedef struct {
+    PyObject_HEAD
+    PyObject* owner;
+    GraphSource* source;
+} GraphViewObject;
+
+typedef struct {
+    PyObject_HEAD
+    GraphViewObject* matrix;
+    Py_ssize_t row;
+} MatrixRowObject;
+
+// What an EdgeView iterator yields.
+enum ViewIterKind { VIEW_ITER_KEYS, VIEW_ITER_VALUES, VIEW_ITER_ITEMS };
+
+typedef struct {
+    PyObject_HEAD
+    GraphViewObject* view;
+    std::string* last;
+    ViewIterKind kind;
+} EdgeViewIterObject;
+
+// Takes ownership of `source` and keeps a reference to `owner`, the Python graph object.
+PyObject* View_create(PyTypeObject* type, PyObject* owner, GraphSource* source);
+
+extern PyTypeObject NodeViewType;
+
+extern PyTypeObject EdgeViewType;
+
+extern PyTypeObject EdgeViewIterType;
+
+extern PyTypeObject MatrixViewType;
+
+extern PyTypeObject MatrixRowType;
+
+#endif
\ No newline at end of file
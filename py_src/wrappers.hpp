@@ -0,0 +1,378 @@
+#ifndef WRAPPERS_PYTHON_HPP
+#define WRAPPERS_PYTHON_HPP
+
+#include <climits>
+#include <exception>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Python.h>
+
+#include "../cpp_src/stella.hpp"
+
+#include "node.hpp"
+#include "edge.hpp"
+
+using std::shared_ptr;
+
+/*
+    Every graph keeps a cache from its C++ nodes and edges to the Python object
+    wrapping them, so getting the same node twice returns the same object instead
+    of allocating a new wrapper and a new heap shared_ptr every time.
+
+    The cache only holds live wrappers: it keeps borrowed references, and a wrapper
+    leaves the cache from its dealloc, so iterating a large graph does not pin a
+    wrapper per item. Each wrapper shares ownership of its C++ object, so an address
+    can never be reused while cached. A wrapper is held by at most one cache, the
+    first graph it was handed out by or added to.
+*/
+
+template<typename T> struct Wrapper;
+
+template<> struct Wrapper<stella::Node> {
+    typedef NodeObject Object;
+    static PyTypeObject* type() { return &NodeType; }
+    static PyObject* create(const shared_ptr<stella::Node>& node) { return Node_wrap(node); }
+};
+
+template<> struct Wrapper<stella::Edge> {
+    typedef EdgeObject Object;
+    static PyTypeObject* type() { return &EdgeType; }
+    static PyObject* create(const shared_ptr<stella::Edge>& edge) { return Edge_wrap(edge); }
+};
+
+template<> struct Wrapper<stella::DirectedEdge> {
+    typedef DirectedEdgeObject Object;
+    static PyTypeObject* type() { return &DirectedEdgeType; }
+    static PyObject* create(const shared_ptr<stella::DirectedEdge>& edge) { return DirectedEdge_wrap(edge); }
+};
+
+class WrapperCache {
+    private:
+        std::unordered_map<const void*, PyObject*> wrappers;
+        static WrapperCache*& owner(PyObject* wrapper) {
+            return ((CachedObject*) wrapper)->cache;
+        }
+    public:
+        WrapperCache() {}
+        WrapperCache(const WrapperCache&) = delete;
+        WrapperCache& operator=(const WrapperCache&) = delete;
+
+        ~WrapperCache() {
+            clear();
+        }
+
+        // Returns a new reference to the wrapper of `item`, creating it if none is alive.
+        template<typename T>
+        PyObject* get(const shared_ptr<T>& item) {
+            auto it = wrappers.find(item.get());
+            if (it == wrappers.end()) {
+                PyObject* wrapper = Wrapper<T>::create(item);
+                if (!wrapper) return NULL;
+                owner(wrapper) = this;
+                wrappers.emplace(item.get(), wrapper);
+                return wrapper;
+            }
+            Py_INCREF(it->second);
+            return it->second;
+        }
+
+        // Records an existing wrapper, e.g. the Node object passed to add_node.
+        void put(const void* item, PyObject* wrapper) {
+            if (owner(wrapper)) return;
+            auto result = wrappers.emplace(item, wrapper);
+            if (!result.second) {
+                owner(result.first->second) = nullptr;
+                result.first->second = wrapper;
+            }
+            owner(wrapper) = this;
+        }
+
+        void forget(const void* item) {
+            auto it = wrappers.find(item);
+            if (it == wrappers.end()) return;
+            owner(it->second) = nullptr;
+            wrappers.erase(it);
+        }
+
+        // Called by a cached wrapper being deallocated.
+        void release(const void* item, PyObject* wrapper) {
+            auto it = wrappers.find(item);
+            if (it != wrappers.end() && it->second == wrapper) wrappers.erase(it);
+        }
+
+        void clear() {
+            for (auto& pair : wrappers)
+                owner(pair.second) = nullptr;
+            wrappers.clear();
+        }
+
+        size_t size() const {
+            return wrappers.size();
+        }
+};
+
+/*
+    METH_FASTCALL versions of the per-item graph methods. Arguments arrive as a C
+    array and are checked directly, which skips building and parsing an argument
+    tuple on every call.
+*/
+
+inline bool Fast_label(PyObject* arg, std::string& label) {
+    if (!PyUnicode_Check(arg)) return false;
+    Py_ssize_t size;
+    const char* data = PyUnicode_AsUTF8AndSize(arg, &size);
+    if (!data) return false;
+    label.assign(data, size);
+    return true;
+}
+
+inline PyObject* Fast_error(const std::exception& ex) {
+    PyErr_SetString(PyExc_RuntimeError, ex.what());
+    return NULL;
+}
+
+template<typename G>
+PyObject* Fast_addNode(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label;
+    if (nargs == 1 && Fast_label(args[0], label)) {
+        try {
+            graph.addNode(label);
+            Py_RETURN_NONE;
+        } catch (std::invalid_argument& ex) {
+            return Fast_error(ex);
+        }
+    }
+    if (PyErr_Occurred()) return NULL;
+
+    if (nargs != 1) {
+        PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_node, expected Node object or str");
+        return NULL;
+    }
+    if (!PyObject_TypeCheck(args[0], &NodeType)) {
+        PyErr_SetString(PyExc_TypeError, "Object must be of Node type");
+        return NULL;
+    }
+    NodeObject* nodeObj = (NodeObject*) args[0];
+    nodeObj->isOwner = false;
+    try {
+        graph.addNode(*nodeObj->node);
+    } catch (std::invalid_argument& ex) {
+        return Fast_error(ex);
+    }
+    wrappers.put(nodeObj->node->get(), args[0]);
+    Py_RETURN_NONE;
+}
+
+// E is the edge type of the graph; undirected graphs refuse directed edges.
+template<typename E, typename G>
+PyObject* Fast_addEdge(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label, n1, n2;
+    if ((nargs == 3 || nargs == 4)
+        && Fast_label(args[0], label) && Fast_label(args[1], n1) && Fast_label(args[2], n2)) {
+        int weight = 1;
+        if (nargs == 4) {
+            long value = PyLong_AsLong(args[3]);
+            if (value == -1 && PyErr_Occurred()) return NULL;
+            if (value < INT_MIN || value > INT_MAX) {
+                PyErr_SetString(PyExc_OverflowError, "Edge weight does not fit in a C int");
+                return NULL;
+            }
+            weight = (int) value;
+        }
+        try {
+            graph.addEdge(label, n1, n2, weight);
+            Py_RETURN_NONE;
+        } catch (std::invalid_argument& ex) {
+            return Fast_error(ex);
+        }
+    }
+    if (PyErr_Occurred()) return NULL;
+
+    if (nargs == 1) {
+        if (!stella::is_directed<E>::value && PyObject_TypeCheck(args[0], &DirectedEdgeType)) {
+            PyErr_SetString(PyExc_TypeError, "Object must be of non-directed Edge type");
+            return NULL;
+        }
+        if (!PyObject_TypeCheck(args[0], Wrapper<E>::type())) {
+            PyErr_SetString(PyExc_TypeError, stella::is_directed<E>::value
+                ? "Object must be of DirectedEdge type" : "Object must be of Edge type");
+            return NULL;
+        }
+        auto edgeObject = (typename Wrapper<E>::Object*) args[0];
+        try {
+            graph.addEdge(*edgeObject->edge);
+        } catch (std::invalid_argument& ex) {
+            return Fast_error(ex);
+        }
+        wrappers.put(edgeObject->edge->get(), args[0]);
+        Py_RETURN_NONE;
+    }
+
+    PyErr_SetString(PyExc_TypeError, "Invalid arguments for add_edge. Expected Edge object or (str, str, str, [int]).");
+    return NULL;
+}
+
+template<typename G>
+PyObject* Fast_getNode(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label;
+    if (nargs != 1 || !Fast_label(args[0], label)) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_ValueError, "No argument for get_node, str expected");
+        return NULL;
+    }
+    auto node = graph.getNode(label);
+    if (!node) Py_RETURN_NONE;
+    return wrappers.get(node);
+}
+
+template<typename G>
+PyObject* Fast_getEdge(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label;
+    if (nargs != 1 || !Fast_label(args[0], label)) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_ValueError, "No argument for get_edge, str expected");
+        return NULL;
+    }
+    auto edge = graph.getEdge(label);
+    if (!edge) Py_RETURN_NONE;
+    return wrappers.get(edge);
+}
+
+// Matrix edge labels are only unique within a cell, so only lists remove by label alone.
+template<typename N, typename E>
+shared_ptr<E> Fast_removeByLabel(stella::AdjList<N, E>& graph, const std::string& label) {
+    return graph.removeEdge(label);
+}
+
+template<typename N, typename E>
+shared_ptr<E> Fast_removeByLabel(stella::AdjMatrix<N, E>& graph, const std::string& label) {
+    return nullptr;
+}
+
+// Removed nodes and edges leave the wrapper cache; Python objects still referring to
+// them keep working, detached from the graph.
+template<typename G>
+PyObject* Fast_removeNode(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label;
+    if (nargs != 1 || !Fast_label(args[0], label)) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "Invalid arguments for remove_node, str expected");
+        return NULL;
+    }
+    std::vector<const void*> removed;
+    graph.forEachIncidentEdge(label, [&](const shared_ptr<typename G::EdgeType>& edge) {
+        removed.push_back(edge.get());
+    });
+    try {
+        removed.push_back(graph.removeNode(label).get());
+    } catch (std::invalid_argument& ex) {
+        return Fast_error(ex);
+    }
+    for (const void* item : removed) wrappers.forget(item);
+    Py_RETURN_NONE;
+}
+
+template<typename G>
+PyObject* Fast_removeEdge(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label, n1, n2;
+    bool labels = (nargs == 1 || nargs == 3) && Fast_label(args[0], label)
+        && (nargs == 1 || (Fast_label(args[1], n1) && Fast_label(args[2], n2)));
+    if (!labels) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "Invalid arguments for remove_edge, expected (str, [str, str])");
+        return NULL;
+    }
+    shared_ptr<typename G::EdgeType> edge;
+    try {
+        edge = nargs == 1 ? Fast_removeByLabel(graph, label) : graph.removeEdge(label, n1, n2);
+    } catch (std::invalid_argument& ex) {
+        return Fast_error(ex);
+    }
+    if (!edge) {
+        PyErr_SetString(PyExc_TypeError, "Matrix edges are removed with remove_edge(label, n1, n2)");
+        return NULL;
+    }
+    wrappers.forget(edge.get());
+    Py_RETURN_NONE;
+}
+
+template<typename G>
+PyObject* Fast_connected(G& graph, PyObject* const* args, Py_ssize_t nargs) {
+    std::string n1, n2;
+    if (nargs != 2 || !Fast_label(args[0], n1) || !Fast_label(args[1], n2)) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "Invalid arguments for connected, expected (str, str)");
+        return NULL;
+    }
+    try {
+        return PyBool_FromLong(graph.connected(n1, n2));
+    } catch (std::invalid_argument& ex) {
+        return Fast_error(ex);
+    }
+}
+
+template<typename G>
+PyObject* Fast_componentOf(G& graph, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label;
+    if (nargs != 1 || !Fast_label(args[0], label)) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "Invalid arguments for component_of, str expected");
+        return NULL;
+    }
+    try {
+        return PyLong_FromLong(graph.componentOf(label));
+    } catch (std::invalid_argument& ex) {
+        return Fast_error(ex);
+    }
+}
+
+// A list with the wrapper of every item of `range` (see ranges.tpp).
+template<typename R>
+PyObject* Fast_wrapRange(WrapperCache& wrappers, const R& range) {
+    PyObject* list = PyList_New(0);
+    if (!list) return NULL;
+    for (const auto& item : range) {
+        PyObject* wrapper = wrappers.get(item);
+        if (!wrapper || PyList_Append(list, wrapper) < 0) {
+            Py_XDECREF(wrapper);
+            Py_DECREF(list);
+            return NULL;
+        }
+        Py_DECREF(wrapper);
+    }
+    return list;
+}
+
+template<typename G>
+PyObject* Fast_incidentEdges(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label;
+    if (nargs != 1 || !Fast_label(args[0], label)) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "Invalid arguments for incident_edges, str expected");
+        return NULL;
+    }
+    try {
+        return Fast_wrapRange(wrappers, stella::incidentEdges(graph, label));
+    } catch (std::invalid_argument& ex) {
+        return Fast_error(ex);
+    }
+}
+
+template<typename G>
+PyObject* Fast_neighbors(G& graph, WrapperCache& wrappers, PyObject* const* args, Py_ssize_t nargs) {
+    std::string label;
+    if (nargs != 1 || !Fast_label(args[0], label)) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "Invalid arguments for neighbors, str expected");
+        return NULL;
+    }
+    try {
+        return Fast_wrapRange(wrappers, stella::neighbors(graph, label));
+    } catch (std::invalid_argument& ex) {
+        return Fast_error(ex);
+    }
+}
+
+#endif
\ No newline at end of file
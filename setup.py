@@ -1,3 +1,5 @@
+import os
+
 from setuptools import setup, Extension
 
 stella_module = Extension(
@@ -11,6 +13,9 @@ stella_module = Extension(
         'py_src/graph.cpp',
         'py_src/adj_list.cpp',
         'py_src/adj_matrix.cpp',
+        'py_src/array.cpp',
+        'py_src/bulk.cpp',
+        'py_src/views.cpp',
     ],
     include_dirs=[
         '/usr/include/python3.11',
@@ -18,7 +23,10 @@ stella_module = Extension(
         'cpp_src'
     ],
     language='c++',
-    extra_compile_args=['-std=c++14'],
+    # STELLA_STATS=1 compiles in the graph operation counters (see cpp_src/stats.hpp).
+    define_macros=[('STELLA_STATS', None)] if os.environ.get('STELLA_STATS') else [],
+    extra_compile_args=['-std=c++14', '-pthread'],
+    extra_link_args=['-pthread'],
 )
 
 setup(
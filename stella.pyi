@@ -1,5 +1,21 @@
 from abc import ABC, abstractmethod
-from typing import Union
+from typing import Iterable, Iterator, Optional, Union
+
+class Array:
+    """
+    Read-only contiguous array returned by the graph export methods.
+    It implements the buffer protocol, so `numpy.asarray(array)` and `memoryview(array)`
+    read its memory directly, without copying.
+
+    Attributes
+    -------
+    `shape (tuple[int, ...])`: dimensions of the array.
+    """
+
+    @property
+    def shape(self) -> tuple[int, ...]: ...
+
+    def __len__(self) -> int: ...
 
 class Node:
     """
@@ -93,6 +109,59 @@ class DirectedEdge(BaseEdge):
         Return a string representation of the Node object (i.e., its label).
     """
 
+class NodeView:
+    """
+    Live, read-only sequence over the nodes of a graph, returned by `Graph.nodes`.
+    It reads the graph on every access, so `len()` is O(1) and Node objects are only
+    created for the items actually accessed.
+
+    Methods
+    -------
+    `__len__(self) -> int`
+    `__getitem__(self, index: int) -> Node`
+    `__contains__(self, node: Union[str, Node]) -> bool`
+        Looks the label up in the graph, in O(1).
+    `__iter__(self) -> Iterator[Node]`
+    """
+
+class EdgeView:
+    """
+    Live, read-only mapping from labels to the edges of an adjacency list, returned by
+    `AdjList.edges`. Iterating yields labels in sorted order, like the keys of a dict.
+    Iteration resumes after the last label seen, so it stays valid while edges are added.
+
+    Methods
+    -------
+    `__len__(self) -> int`
+    `__getitem__(self, label: str) -> BaseEdge`
+    `__contains__(self, label: str) -> bool`
+    `__iter__(self) -> Iterator[str]`
+    `keys(self) -> Iterator[str]`
+    `values(self) -> Iterator[BaseEdge]`
+    `items(self) -> Iterator[tuple[str, BaseEdge]]`
+    `get(self, label: str, default=None) -> Union[BaseEdge, None]`
+    """
+
+class MatrixView:
+    """
+    Live, read-only view over the rows of an adjacency matrix, returned by `AdjMatrix.edges`.
+    `view[i][j]` builds a `dict[str, BaseEdge]` for that single cell only.
+
+    Methods
+    -------
+    `__len__(self) -> int`
+        Number of rows, i.e. of nodes.
+    `__getitem__(self, row: int) -> MatrixRow`
+    `__contains__(self, edge: BaseEdge) -> bool`
+        Checks the cell of the edge's nodes for its label.
+    """
+
+class MatrixRow:
+    """
+    Live, read-only view over one row of an adjacency matrix.
+    Each item is the `dict[str, BaseEdge]` of one cell.
+    """
+
 class Graph(ABC):
     """
     Abstract base class for the definition of common methods for all graph classes.
@@ -156,14 +225,292 @@ class Graph(ABC):
         Returns a node from the graph. If the label is not found, a `None` value is returned.
         """
 
+    def remove_node(self, label: str) -> None:
+        """
+        Removes a node and every edge touching it. The last node takes the place of the
+        removed one in `nodes` and in the exported arrays. Node and edge objects obtained
+        before keep working, detached from the graph.
+
+        Raises
+        -------
+        `RuntimeError`: if the label is not found.
+        """
+
+    def remove_edge(self, label: str, n1: str=None, n2: str=None) -> None:
+        """
+        Removes the edge with this label joining `n1` and `n2`. Adjacency lists also
+        accept the label alone, as their edge labels are unique.
+
+        Raises
+        -------
+        `RuntimeError`: if no such edge is found.
+        `TypeError`: if only the label is given to an adjacency matrix.
+        """
+
+    def add_nodes(self, labels: Iterable[str]) -> None:
+        """
+        Adds a Node object for every label. All labels are read first, then the nodes are
+        inserted with the GIL released. Either every node is added or none is.
+
+        Raises
+        -------
+        `RuntimeError`: if a label already exists, or if the graph is already busy with
+        another bulk insertion.
+        """
+
+    def add_edges(self, edges: Iterable[tuple], n1: Iterable[str]=None, n2: Iterable[str]=None,
+                  weights: Iterable[int]=None) -> None:
+        """
+        Adds many edges at once, with the GIL released during the insertion.
+        This method has two possible signatures:
+
+        `add_edges(edges: Iterable[tuple[str, str, str] | tuple[str, str, str, int]])`
+            Rows of `(label, n1, n2)` or `(label, n1, n2, weight)`.
+
+        `add_edges(labels: Iterable[str], n1: Iterable[str], n2: Iterable[str], weights = None)`
+            Columns of equal length. `weights` may be any integer buffer, such as a NumPy
+            array, which is read without conversion. Missing weights default to 1.
+
+        Raises
+        -------
+        `RuntimeError`: if a node label is not found, if an edge label already exists,
+        or if the graph is already busy with another bulk insertion.
+        """
+
+    def generate_erdos_renyi(self, n: int, p: float, seed: int=0, *, threads: int=1) -> None:
+        """
+        Fills the empty graph with a G(n, p) random graph: nodes `"0"` to `"n-1"`, and an
+        edge between each pair of distinct nodes (ordered pairs for directed graphs) with
+        probability `p`. Edges are labeled `"0"`, `"1"`... in order. Generating runs on
+        `threads` threads (0 for one per core) with the GIL released; the same seed gives
+        the same graph for any thread count. The other `generate_` methods work the same
+        way, and all of them require a graph without nodes.
+
+        Raises
+        -------
+        `ValueError`: if `threads` is negative.
+        `RuntimeError`: if `p` is not in [0, 1], if the graph already has nodes, or if
+        the graph is busy.
+        """
+
+    def generate_rmat(self, scale: int, edges: int, seed: int=0, *, a: float=0.57, b: float=0.19,
+                      c: float=0.19, threads: int=1) -> None:
+        """
+        Fills the empty graph with an R-MAT (Kronecker) graph of `2**scale` nodes and `edges` edges, each placed by
+        choosing a quadrant of the adjacency matrix with probabilities `a`, `b`, `c` and
+        `1 - a - b - c`, once per bit. The defaults are those of Graph500. Self-loops and
+        parallel edges are kept.
+        """
+
+    def generate_barabasi_albert(self, n: int, m: int, seed: int=0, *, threads: int=1) -> None:
+        """
+        Fills the empty graph with a Barabási-Albert preferential attachment graph: each node after `"0"` links to
+        `m` earlier nodes chosen in proportion to their degree. Parallel edges may occur.
+        """
+
+    def generate_grid(self, rows: int, cols: int, drop: float=0.0, seed: int=0, *, threads: int=1) -> None:
+        """
+        Fills the empty graph with a `rows` x `cols` grid, node `r * cols + c` linked to its right and lower
+        neighbors. Each link is left out with probability `drop`, for road-like graphs.
+        """
+
+    def edge_arrays(self) -> tuple[Array, Array, Array]:
+        """
+        Returns `(sources, targets, weights)` int64 arrays with one entry per edge.
+        Sources and targets are node indices, following the order of `nodes`.
+        """
+
+    def csr(self) -> tuple[Array, Array, Array]:
+        """
+        Returns the `(offsets, targets, weights)` int64 arrays of the compressed sparse row
+        adjacency, e.g. `scipy.sparse.csr_matrix((weights, targets, offsets))`.
+        Non-directed edges appear in the rows of both of their nodes.
+        """
+
+    def to_dense(self) -> Array:
+        """
+        Returns the V x V int64 weight matrix. Parallel edges are summed.
+        """
+
+    def bfs(self, source: str, *, threads: int=1) -> Array:
+        """
+        Returns the int64 hop distance from `source` to every node, following the order
+        of `nodes`, or -1 for unreachable nodes. Directed graphs follow edge direction.
+
+        The algorithms below all run with the GIL released and split their work over
+        `threads` threads; `threads=0` uses one per hardware thread.
+
+        Raises
+        -------
+        `RuntimeError`: if the source label is not found, or if the graph is busy.
+        """
+
+    def shortest_paths(self, source: Union[str, Iterable[str]], *, threads: int=1) -> tuple[Array, Array]:
+        """
+        Returns Dijkstra's `(distances, predecessors)` int64 arrays from `source`, with -1
+        for unreachable nodes and for the source's predecessor. Given a sequence of
+        sources, both arrays have one row per source, and sources are split over the threads.
+
+        Raises
+        -------
+        `RuntimeError`: if a source label is not found, if an edge has a negative weight,
+        or if the graph is busy.
+        """
+
+    def components(self, *, threads: int=1) -> Array:
+        """
+        Returns the int64 connected component number of every node, weakly connected
+        for directed graphs. Components are numbered from 0 in the order of their first node.
+        """
+
+    def connected(self, n1: str, n2: str) -> bool:
+        """
+        Checks whether two nodes are in the same connected component, weakly connected
+        for directed graphs. The first call of `connected`, `component_of` or
+        `component_count` builds a union-find over the graph. Later inserts keep it
+        up to date, so these queries stay cheap while edges are only added. A removal
+        discards it, and the next query rebuilds it.
+
+        Raises
+        -------
+        `RuntimeError`: if a label is not found, or if the graph is busy.
+        """
+
+    def component_of(self, label: str) -> int:
+        """
+        Returns the index of the node that stands for the component of `label`. Two nodes
+        share it exactly when they are `connected`, but it may change when components merge.
+
+        Raises
+        -------
+        `RuntimeError`: if the label is not found, or if the graph is busy.
+        """
+
+    def component_count(self) -> int:
+        """
+        Returns the number of connected components, maintained like `connected`.
+        """
+
+    def incident_edges(self, label: str) -> list[BaseEdge]:
+        """
+        Returns the edges touching the node, incoming ones included for directed graphs,
+        without scanning the other edges of an `AdjList` (an `AdjMatrix` reads the row and
+        column of the node).
+
+        Raises
+        -------
+        `RuntimeError`: if the label is not found, or if the graph is busy.
+        """
+
+    def neighbors(self, label: str) -> list[Node]:
+        """
+        Returns the node at the other end of each edge leaving the node, once per edge.
+        For non-directed graphs every touching edge counts as leaving.
+
+        Raises
+        -------
+        `RuntimeError`: if the label is not found, or if the graph is busy.
+        """
+
+    def pagerank(self, damping: float=0.85, iterations: int=100, tolerance: float=1e-6,
+                 *, threads: int=1) -> Array:
+        """
+        Returns the float64 PageRank of every node, ignoring weights. Stops after
+        `iterations` rounds or once the total change of a round is below `tolerance`.
+        """
+
+    def reorder(self, strategy: str="rcm") -> Array:
+        """
+        Renumbers the nodes so that neighbors get nearby indices, which speeds up the
+        exports and algorithms that work on node indices. `strategy` is `"rcm"` (reverse
+        Cuthill-McKee), `"degree"` (highest degree first) or `"gorder"`. Returns the int64
+        order applied: node `i` of `nodes` is the one that was at index `order[i]`.
+        Node and edge objects are unaffected; edge directions are ignored when ordering.
+
+        Raises
+        -------
+        `ValueError`: if the strategy is unknown.
+        `RuntimeError`: if the graph is busy.
+        """
+
+    def khop(self, label: str, k: int) -> "Graph":
+        """
+        Returns a new graph of the same type with the nodes at most `k` hops from
+        `label` (its ego network) and the edges between them, `label` first and the
+        others in BFS order. Directed graphs follow outgoing edges only. Nodes and
+        edges are copies, so the new graph is independent of this one.
+
+        Raises
+        -------
+        `ValueError`: if `k` is negative.
+        `RuntimeError`: if the node is not found or the graph is busy.
+        """
+
+    def induced_subgraph(self, labels: Iterable[str]) -> "Graph":
+        """
+        Returns a new graph of the same type with the given nodes, in that order, and
+        every edge between two of them. Nodes and edges are copies, so the new graph
+        is independent of this one.
+
+        Raises
+        -------
+        `RuntimeError`: if a node is not found or the graph is busy.
+        """
+
+    def stats(self) -> Union[dict, None]:
+        """
+        Returns the operation counters of the graph: for each of `node_inserts`, `edge_inserts`,
+        `node_lookups`, `edge_lookups`, `bulk_node_inserts`, `bulk_edge_inserts`,
+        `node_removals` and `edge_removals`, a dict with
+        `count`, `failed`, `total_ns`, `max_ns`, `p50_ns`, `p99_ns` and the log2 `histogram`
+        of latencies; plus the `growths` and `reallocations` of the storage.
+
+        Returns None unless the extension was built with `STELLA_STATS=1` in the environment.
+        """
+
+    def reset_stats(self) -> None:
+        """
+        Clears the counters returned by `stats()`.
+        """
+
+    def memory_usage(self) -> dict[str, int]:
+        """
+        Returns the bytes held by the C++ graph, by category: `nodes` and `edges` objects,
+        heap-allocated `labels`, shared pointer `control_blocks`, index `containers`, and
+        for matrices the `matrix_cells`, plus their `total`. The numbers are computed from
+        the containers assuming glibc malloc, and do not include the Python objects.
+        """
+
+    def fingerprint(self) -> int:
+        """
+        Returns a 64-bit hash of the node labels and of the edge labels and endpoints,
+        independent of insertion order and of weights. Equal graphs have equal fingerprints,
+        so it can bucket graphs before comparing them with `==`. Only comparable within
+        the same process.
+        """
+
+    def epoch(self) -> int:
+        """
+        Returns a value that changes on every successful insert or removal, and on
+        `__init__`. Values are never shared between graphs of one process. A result
+        computed from the graph stays valid while `epoch()` is unchanged, so caches can
+        key results by their arguments plus the epoch, e.g. `(source, graph.epoch())`.
+        """
+
     @property
-    def nodes(self) -> list[Node]: ...
+    def nodes(self) -> NodeView: ...
 
 class AdjList(Graph):
     """
     Class representation of a non-directed adjacency list.
     Implements a `dict[Edge]` for its Edge objects, with its labels as keys, for the edges.
 
+    `__init__(self, graph: Optional[AdjMatrix] = None)`
+        Initialize an empty AdjList, or convert `graph` in one pass over its edges: node
+        order and fingerprint are kept, and the Node and Edge objects are shared with `graph`.
+        Raises RuntimeError if two edges of `graph` share a label, which a matrix allows
+        across different cells.
+
     Attributes
     -------
     `_nodes (list[Node])`: contains all the nodes present in the AdjList. Readonly via @property.
@@ -185,8 +532,10 @@ class AdjList(Graph):
         Retrieves an Edge object from the graph.
     """
 
+    def __init__(self, graph: Optional[AdjMatrix] = None): ...
+
     @property
-    def edges(self) -> dict[Edge]:
+    def edges(self) -> EdgeView:
         """
         Returns the edges from the AdjList.
         """
@@ -202,6 +551,12 @@ class DirectedAdjList(AdjList):
     Class representation of a directed adjacency list.
     Implements a `dict[DirectedEdge]` for its Edge objects, with its labels as keys, for the edges.
 
+    `__init__(self, graph: Optional[DirectedAdjMatrix] = None)`
+        Initialize an empty DirectedAdjList, or convert `graph` in one pass over its edges: node
+        order and fingerprint are kept, and the Node and Edge objects are shared with `graph`.
+        Raises RuntimeError if two edges of `graph` share a label, which a matrix allows
+        across different cells.
+
     Attributes
     -------
     `_nodes (list[Node])`: contains all the nodes present in the AdjList. Readonly via @property.
@@ -222,6 +577,9 @@ class DirectedAdjList(AdjList):
     `get_edge(label: str)`
         Retrieves an DirectedEdge object from the graph.
     """
+
+    def __init__(self, graph: Optional[DirectedAdjMatrix] = None): ...
+
     @property
     def get_edge(self, label: str) -> Union[DirectedEdge, None]: ...
 
@@ -230,6 +588,10 @@ class AdjMatrix(Graph):
     Class representation of a non-directed adjacency matrix.
     Implements a non-squared `list[list[Edge]]` for its edge objects.
 
+    `__init__(self, graph: Optional[AdjList] = None)`
+        Initialize an empty AdjMatrix, or convert `graph` in one pass over its edges: node
+        order and fingerprint are kept, and the Node and Edge objects are shared with `graph`.
+
     Attributes
     -------
     `_nodes (list[Node])`: contains all the nodes present in the AdjList. Readonly via @property.
@@ -249,8 +611,10 @@ class AdjMatrix(Graph):
         Retrieves a Node object from the graph.
     """
 
+    def __init__(self, graph: Optional[AdjList] = None): ...
+
     @property
-    def edges(self) -> list[list[Edge]]:
+    def edges(self) -> MatrixView:
         """
         Returns the edges matrix from the AdjMatrix.
         For the non-directed adjacency matrix, this module implements a non-squared 2D list,
@@ -267,6 +631,10 @@ class DirectedAdjMatrix(AdjMatrix):
     Class representation of a non-directed adjacency matrix.
     Implements a squared `list[list[DirectedEdge]]` for its edge objects.
 
+    `__init__(self, graph: Optional[DirectedAdjList] = None)`
+        Initialize an empty DirectedAdjMatrix, or convert `graph` in one pass over its edges: node
+        order and fingerprint are kept, and the Node and Edge objects are shared with `graph`.
+
     Attributes
     -------
     `_nodes (list[Node])`: contains all the nodes present in the AdjList. Readonly via @property.
@@ -285,8 +653,11 @@ class DirectedAdjMatrix(AdjMatrix):
     `get_node(label: str)`
         Retrieves a Node object from the graph.
     """
+
+    def __init__(self, graph: Optional[DirectedAdjList] = None): ...
+
     @property
-    def edges(self) -> list[list[DirectedEdge]]:
+    def edges(self) -> MatrixView:
         """
         Returns the edges matrix from the AdjMatrix.
         For the directed adjacency matrix, this module implements a squared 2D list,